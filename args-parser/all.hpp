@@ -7,7 +7,11 @@
 #ifndef ARGS__ALL_HPP__INCLUDED
 #define ARGS__ALL_HPP__INCLUDED
 
+#include "choice_arg.hpp"
 #include "cmd_line.hpp"
+#include "list_arg.hpp"
+#include "positional_queue.hpp"
+#include "typed_arg.hpp"
 #include "types.hpp"
 
 #endif // ARGS__ALL_HPP__INCLUDED
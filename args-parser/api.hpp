@@ -8,18 +8,53 @@
 #define ARGS__API_HPP__INCLUDED
 
 // Args include.
+#include "arena.hpp"
 #include "arg.hpp"
 #include "command.hpp"
 #include "groups.hpp"
 #include "multi_arg.hpp"
 #include "types.hpp"
 
+// C++ include.
+#include <memory>
+#include <new>
+#include <utility>
+
 namespace Args
 {
 
 namespace details
 {
 
+//
+// arenaOf
+//
+
+//! \return Arena of the command line parser the argument belongs to or nullptr.
+inline Arena *arenaOf(const ArgIface &arg);
+
+//! \return Arena of the command line parser or nullptr.
+inline Arena *arenaOf(const CmdLine &cmdLine);
+
+//
+// makeArg
+//
+
+//! \return New argument allocated in the arena if it's given or on the heap.
+template<typename T, typename... Params>
+std::unique_ptr<T, Deleter<ArgIface>> makeArg(Arena *arena,
+                                              Params &&...params)
+{
+    if (arena) {
+        void *place = arena->allocate(sizeof(T), alignof(T));
+
+        return std::unique_ptr<T, Deleter<ArgIface>>(new (place) T(std::forward<Params>(params)...),
+                                                     Deleter<ArgIface>(true, true));
+    }
+
+    return std::unique_ptr<T, Deleter<ArgIface>>(new T(std::forward<Params>(params)...), Deleter<ArgIface>(true));
+} // makeArg
+
 //
 // API
 //
@@ -65,9 +100,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group = std::unique_ptr<OnlyOneGroup, details::Deleter<ArgIface>>(
-            new OnlyOneGroup(std::forward<NAME>(name), required),
-            details::Deleter<ArgIface>(true));
+        auto group = makeArg<OnlyOneGroup>(arena(), std::forward<NAME>(name), required);
 
         OnlyOneGroup &g = *group;
 
@@ -93,9 +126,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group =
-            std::unique_ptr<AllOfGroup, details::Deleter<ArgIface>>(new AllOfGroup(std::forward<NAME>(name), required),
-                                                                    details::Deleter<ArgIface>(true));
+        auto group = makeArg<AllOfGroup>(arena(), std::forward<NAME>(name), required);
 
         AllOfGroup &g = *group;
 
@@ -121,9 +152,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group = std::unique_ptr<AtLeastOneGroup, details::Deleter<ArgIface>>(
-            new AtLeastOneGroup(std::forward<NAME>(name), required),
-            details::Deleter<ArgIface>(true));
+        auto group = makeArg<AtLeastOneGroup>(arena(), std::forward<NAME>(name), required);
 
         AtLeastOneGroup &g = *group;
 
@@ -158,9 +187,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<Arg, details::Deleter<ArgIface>>(
-            new Arg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -206,8 +233,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<Arg, details::Deleter<ArgIface>>(new Arg(flag, isWithValue, isRequired),
-                                                                    details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -254,9 +280,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg =
-            std::unique_ptr<Arg, details::Deleter<ArgIface>>(new Arg(std::forward<NAME>(name), isWithValue, isRequired),
-                                                             details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -305,9 +329,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -353,8 +375,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(new MultiArg(flag, isWithValue, isRequired),
-                                                                         details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -401,9 +422,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -452,9 +471,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -500,8 +517,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(new MultiArg(flag, isWithValue, isRequired),
-                                                                         details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -548,9 +564,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -636,9 +650,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto cmd = std::unique_ptr<Command, details::Deleter<ArgIface>>(
-            new Command(std::forward<NAME>(name), opt, isSubCommandRequired),
-            details::Deleter<ArgIface>(true));
+        auto cmd = makeArg<Command>(arena(), std::forward<NAME>(name), opt, isSubCommandRequired);
 
         if (!desc.empty()) {
             cmd->setDescription(desc);
@@ -690,9 +702,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto cmd = std::unique_ptr<Command, details::Deleter<ArgIface>>(
-            new Command(std::forward<NAME>(name), opt, isSubCommandRequired),
-            details::Deleter<ArgIface>(true));
+        auto cmd = makeArg<Command>(arena(), std::forward<NAME>(name), opt, isSubCommandRequired);
 
         if (!desc.empty()) {
             cmd->setDescription(desc);
@@ -725,6 +735,13 @@ public:
         return m_parent;
     }
 
+private:
+    //! \return Arena for the new arguments or nullptr.
+    Arena *arena() const
+    {
+        return arenaOf(m_self);
+    }
+
 private:
     //! Parent.
     PARENT &m_parent;
@@ -767,9 +784,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group = std::unique_ptr<OnlyOneGroup, details::Deleter<ArgIface>>(
-            new OnlyOneGroup(std::forward<NAME>(name), required),
-            details::Deleter<ArgIface>(true));
+        auto group = makeArg<OnlyOneGroup>(arena(), std::forward<NAME>(name), required);
 
         OnlyOneGroup &g = *group;
 
@@ -795,9 +810,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group =
-            std::unique_ptr<AllOfGroup, details::Deleter<ArgIface>>(new AllOfGroup(std::forward<NAME>(name), required),
-                                                                    details::Deleter<ArgIface>(true));
+        auto group = makeArg<AllOfGroup>(arena(), std::forward<NAME>(name), required);
 
         AllOfGroup &g = *group;
 
@@ -823,9 +836,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group = std::unique_ptr<AtLeastOneGroup, details::Deleter<ArgIface>>(
-            new AtLeastOneGroup(std::forward<NAME>(name), required),
-            details::Deleter<ArgIface>(true));
+        auto group = makeArg<AtLeastOneGroup>(arena(), std::forward<NAME>(name), required);
 
         AtLeastOneGroup &g = *group;
 
@@ -860,9 +871,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<Arg, details::Deleter<ArgIface>>(
-            new Arg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -908,8 +917,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<Arg, details::Deleter<ArgIface>>(new Arg(flag, isWithValue, isRequired),
-                                                                    details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -956,9 +964,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg =
-            std::unique_ptr<Arg, details::Deleter<ArgIface>>(new Arg(std::forward<NAME>(name), isWithValue, isRequired),
-                                                             details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1007,9 +1013,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1055,8 +1059,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(new MultiArg(flag, isWithValue, isRequired),
-                                                                         details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1103,9 +1106,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1154,9 +1155,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1202,8 +1201,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(new MultiArg(flag, isWithValue, isRequired),
-                                                                         details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1250,9 +1248,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1338,9 +1334,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto cmd = std::unique_ptr<Command, details::Deleter<ArgIface>>(
-            new Command(std::forward<NAME>(name), opt, isSubCommandRequired),
-            details::Deleter<ArgIface>(true));
+        auto cmd = makeArg<Command>(arena(), std::forward<NAME>(name), opt, isSubCommandRequired);
 
         if (!desc.empty()) {
             cmd->setDescription(desc);
@@ -1392,9 +1386,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto cmd = std::unique_ptr<Command, details::Deleter<ArgIface>>(
-            new Command(std::forward<NAME>(name), opt, isSubCommandRequired),
-            details::Deleter<ArgIface>(true));
+        auto cmd = makeArg<Command>(arena(), std::forward<NAME>(name), opt, isSubCommandRequired);
 
         if (!desc.empty()) {
             cmd->setDescription(desc);
@@ -1427,6 +1419,13 @@ public:
         return m_parent;
     }
 
+private:
+    //! \return Arena for the new arguments or nullptr.
+    Arena *arena() const
+    {
+        return arenaOf(m_self);
+    }
+
 private:
     //! Parent.
     PARENT &m_parent;
@@ -1466,9 +1465,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group = std::unique_ptr<OnlyOneGroup, details::Deleter<ArgIface>>(
-            new OnlyOneGroup(std::forward<NAME>(name), required),
-            details::Deleter<ArgIface>(true));
+        auto group = makeArg<OnlyOneGroup>(arena(), std::forward<NAME>(name), required);
 
         OnlyOneGroup &g = *group;
 
@@ -1491,9 +1488,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group =
-            std::unique_ptr<AllOfGroup, details::Deleter<ArgIface>>(new AllOfGroup(std::forward<NAME>(name), required),
-                                                                    details::Deleter<ArgIface>(true));
+        auto group = makeArg<AllOfGroup>(arena(), std::forward<NAME>(name), required);
 
         AllOfGroup &g = *group;
 
@@ -1516,9 +1511,7 @@ public:
         //! Is group required?
         bool required = false)
     {
-        auto group = std::unique_ptr<AtLeastOneGroup, details::Deleter<ArgIface>>(
-            new AtLeastOneGroup(std::forward<NAME>(name), required),
-            details::Deleter<ArgIface>(true));
+        auto group = makeArg<AtLeastOneGroup>(arena(), std::forward<NAME>(name), required);
 
         AtLeastOneGroup &g = *group;
 
@@ -1549,9 +1542,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<Arg, details::Deleter<ArgIface>>(
-            new Arg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1593,8 +1584,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<Arg, details::Deleter<ArgIface>>(new Arg(flag, isWithValue, isRequired),
-                                                                    details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1637,9 +1627,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg =
-            std::unique_ptr<Arg, details::Deleter<ArgIface>>(new Arg(std::forward<NAME>(name), isWithValue, isRequired),
-                                                             details::Deleter<ArgIface>(true));
+        auto arg = makeArg<Arg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1684,9 +1672,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1728,8 +1714,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(new MultiArg(flag, isWithValue, isRequired),
-                                                                         details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1772,9 +1757,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1819,9 +1802,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(flag, std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1863,8 +1844,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(new MultiArg(flag, isWithValue, isRequired),
-                                                                         details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), flag, isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1907,9 +1887,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto arg = std::unique_ptr<MultiArg, details::Deleter<ArgIface>>(
-            new MultiArg(std::forward<NAME>(name), isWithValue, isRequired),
-            details::Deleter<ArgIface>(true));
+        auto arg = makeArg<MultiArg>(arena(), std::forward<NAME>(name), isWithValue, isRequired);
 
         if (!desc.empty()) {
             arg->setDescription(desc);
@@ -1956,9 +1934,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto cmd = std::unique_ptr<Command, details::Deleter<ArgIface>>(
-            new Command(std::forward<NAME>(name), opt, isSubCommandRequired),
-            details::Deleter<ArgIface>(true));
+        auto cmd = makeArg<Command>(arena(), std::forward<NAME>(name), opt, isSubCommandRequired);
 
         if (!desc.empty()) {
             cmd->setDescription(desc);
@@ -2007,9 +1983,7 @@ public:
         //! Value specifier.
         const String &valueSpecifier = String())
     {
-        auto cmd = std::unique_ptr<Command, details::Deleter<ArgIface>>(
-            new Command(std::forward<NAME>(name), opt, isSubCommandRequired),
-            details::Deleter<ArgIface>(true));
+        auto cmd = makeArg<Command>(arena(), std::forward<NAME>(name), opt, isSubCommandRequired);
 
         if (!desc.empty()) {
             cmd->setDescription(desc);
@@ -2036,6 +2010,13 @@ public:
         return API<PARENT, Command, ARGPTR, false>(m_self, c);
     }
 
+private:
+    //! \return Arena for the new arguments or nullptr.
+    Arena *arena() const
+    {
+        return arenaOf(m_self);
+    }
+
 private:
     //! Parent.
     PARENT &m_parent;
@@ -0,0 +1,117 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__ARENA_HPP__INCLUDED
+#define ARGS__ARENA_HPP__INCLUDED
+
+// Args include.
+#include "utils.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// Arena
+//
+
+/*!
+    Monotonic arena. Memory is taken from the big blocks one after
+    another and is freed all at once with the arena.
+
+    \note Arena doesn't call destructors, owners of the objects should
+        destroy them.
+*/
+class Arena final
+{
+public:
+    //! Default size of the block.
+    static const std::size_t c_defaultBlockSize = 16 * 1024;
+
+    explicit Arena(std::size_t blockSize = c_defaultBlockSize)
+        : m_current(nullptr)
+        , m_left(0)
+        , m_blockSize(blockSize)
+        , m_size(0)
+    {
+    }
+
+    //! \return Memory for the object with the given size and alignment.
+    void *allocate(std::size_t size,
+                   std::size_t alignment)
+    {
+        std::size_t padding = padTo(m_current, alignment);
+
+        if (!m_current || padding + size > m_left) {
+            const std::size_t blockSize = (size + alignment > m_blockSize ? size + alignment : m_blockSize);
+
+            m_blocks.emplace_back(new char[blockSize]);
+
+            m_current = m_blocks.back().get();
+            m_left = blockSize;
+
+            padding = padTo(m_current, alignment);
+        }
+
+        char *place = m_current + padding;
+
+        m_current = place + size;
+        m_left -= padding + size;
+        m_size += size;
+
+        return place;
+    }
+
+    //! \return Count of allocated bytes.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    //! \return Count of blocks.
+    std::size_t blocksCount() const
+    {
+        return m_blocks.size();
+    }
+
+private:
+    //! \return Count of bytes to align the given pointer.
+    static std::size_t padTo(const char *p,
+                             std::size_t alignment)
+    {
+        const std::size_t rest = reinterpret_cast<std::uintptr_t>(p) % alignment;
+
+        return (rest ? alignment - rest : 0);
+    }
+
+private:
+    DISABLE_COPY(Arena)
+
+    //! Blocks.
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    //! Free memory in the current block.
+    char *m_current;
+    //! Count of free bytes in the current block.
+    std::size_t m_left;
+    //! Size of the block.
+    std::size_t m_blockSize;
+    //! Count of allocated bytes.
+    std::size_t m_size;
+}; // class Arena
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__ARENA_HPP__INCLUDED
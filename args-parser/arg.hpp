@@ -11,6 +11,7 @@
 #include "arg_iface.hpp"
 #include "context.hpp"
 #include "exceptions.hpp"
+#include "parse_error.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 #include "value_utils.hpp"
@@ -137,6 +138,32 @@ public:
         return *this;
     }
 
+    //! \return Name of the environment variable the value is taken from.
+    const String &envVar() const override
+    {
+        return m_envVar;
+    }
+
+    /*!
+        Bind the argument to the environment variable, empty name to unbind.
+
+        Argument not defined in the command line takes the value from
+        the variable when the command line is parsed, and isDefined()
+        is true then. Argument without value takes "true", "yes", "on",
+        "1" or empty value as defined and "false", "no", "off", "0" as
+        not defined. MultiArg takes the value of the variable as one value.
+
+        Command line overrides the environment, and the environment
+        overrides the config file, see CmdLine::setConfigFile().
+    */
+    Arg &setEnvVar(const String &name);
+
+    //! \return Can the given string be the value of the argument?
+    virtual bool isValueValid(const String &) const
+    {
+        return true;
+    }
+
     //! \return Is given name a misspelled name of the argument.
     bool isMisspelledName(
         //! Name to check (misspelled).
@@ -235,6 +262,8 @@ private:
     String m_longDescription;
     //! Default value.
     String m_defaultValue;
+    //! Name of the environment variable.
+    String m_envVar;
 }; // class Arg
 
 //
@@ -290,14 +319,12 @@ inline void Arg::process(Context &context)
         if (!isWithValue()) {
             setDefined(true);
         } else {
-            setValue(eatOneValue(context,
-                                 String(SL("Argument \"")) + name() + SL("\" requires value that wasn't presented."),
-                                 cmdLine()));
+            setValue(eatOneValue(context, this, cmdLine()));
 
             setDefined(true);
         }
     } else {
-        throw BaseException(String(SL("Argument \"")) + name() + SL("\" already defined."));
+        details::reportError(cmdLine(), ParseError(ParseErrorCode::AlreadyDefined, this));
     }
 }
 
@@ -320,15 +347,15 @@ inline void Arg::checkCorrectnessBeforeParsing(StringList &flags,
             auto it = std::find(flags.begin(), flags.end(), flag);
 
             if (it != flags.end()) {
-                throw BaseException(String(SL("Redefinition of argument "
-                                              "with flag \""))
-                                    + flag
-                                    + SL("\"."));
+                ARGS_THROW(BaseException(String(SL("Redefinition of argument "
+                                                   "with flag \""))
+                                         + flag
+                                         + SL("\".")));
             } else {
                 flags.push_back(flag);
             }
         } else {
-            throw BaseException(String(SL("Disallowed flag \"-")) + m_flag + SL("\"."));
+            ARGS_THROW(BaseException(String(SL("Disallowed flag \"-")) + m_flag + SL("\".")));
         }
     }
 
@@ -339,29 +366,29 @@ inline void Arg::checkCorrectnessBeforeParsing(StringList &flags,
             auto it = std::find(names.begin(), names.end(), name);
 
             if (it != names.end()) {
-                throw BaseException(String(SL("Redefinition of argument "
-                                              "with name \""))
-                                    + name
-                                    + SL("\"."));
+                ARGS_THROW(BaseException(String(SL("Redefinition of argument "
+                                                   "with name \""))
+                                         + name
+                                         + SL("\".")));
             } else {
                 names.push_back(name);
             }
         } else {
-            throw BaseException(String(SL("Disallowed name \"--")) + m_name + SL("\"."));
+            ARGS_THROW(BaseException(String(SL("Disallowed name \"--")) + m_name + SL("\".")));
         }
     }
 
     if (m_flag.empty() && m_name.empty()) {
-        throw BaseException(
+        ARGS_THROW(BaseException(
             String(SL("Arguments with empty flag and name "
-                      "are disallowed.")));
+                      "are disallowed."))));
     }
 }
 
 inline void Arg::checkCorrectnessAfterParsing() const
 {
     if (isRequired() && !isDefined()) {
-        throw BaseException(String(SL("Undefined required argument \"")) + name() + SL("\"."));
+        details::reportError(cmdLine(), ParseError(ParseErrorCode::RequiredArgumentNotDefined, this));
     }
 }
 
@@ -384,6 +411,7 @@ inline bool Arg::isRequired() const
 inline Arg &Arg::setRequired(bool on)
 {
     m_isRequired = on;
+    notifyTreeChanged();
     return *this;
 }
 
@@ -421,6 +449,7 @@ inline const String &Arg::flag() const
 inline Arg &Arg::setFlag(Char f)
 {
     m_flag = String(1, f);
+    notifyTreeChanged();
     return *this;
 }
 
@@ -432,6 +461,7 @@ inline const String &Arg::argumentName() const
 inline Arg &Arg::setArgumentName(const String &name)
 {
     m_name = name;
+    notifyTreeChanged();
     return *this;
 }
 
@@ -472,6 +502,13 @@ inline Arg &Arg::setLongDescription(const String &desc)
     return *this;
 }
 
+inline Arg &Arg::setEnvVar(const String &name)
+{
+    m_envVar = name;
+    notifyTreeChanged();
+    return *this;
+}
+
 } /* namespace Args */
 
 #endif // ARGS__ARG_HPP__INCLUDED
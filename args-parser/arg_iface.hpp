@@ -12,6 +12,9 @@
 #include "types.hpp"
 #include "utils.hpp"
 
+// C++ include.
+#include <cstddef>
+
 namespace Args
 {
 
@@ -20,6 +23,13 @@ class CmdLine;
 class GroupIface;
 class Command;
 
+namespace details
+{
+
+class ArgsSink;
+
+} /* namespace details */
+
 //
 // ArgIface
 //
@@ -30,10 +40,13 @@ class ArgIface
     friend class CmdLine;
     friend class GroupIface;
     friend class Command;
+    friend class ParseResult;
+    friend class details::ArgsSink;
 
 public:
     ArgIface()
         : m_cmdLine(nullptr)
+        , m_id(0)
     {
     }
 
@@ -82,6 +95,12 @@ public:
         return m_dummy;
     }
 
+    //! \return Name of the environment variable the value is taken from.
+    virtual const String &envVar() const
+    {
+        return m_dummy;
+    }
+
     //! \return Command line parser.
     CmdLine *cmdLine() const
     {
@@ -144,11 +163,16 @@ protected:
         m_cmdLine = cmdLine;
     }
 
+    //! Notify command line parser that the tree of arguments was changed.
+    void notifyTreeChanged();
+
 private:
     DISABLE_COPY(ArgIface)
 
     //! Command line parser.
     CmdLine *m_cmdLine;
+    //! Index of the argument in the tree, set with CmdLine::freeze().
+    std::size_t m_id;
     //! Dummy string object.
     String m_dummy;
 }; // class ArgIface
@@ -0,0 +1,145 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__BATCH_HPP__INCLUDED
+#define ARGS__BATCH_HPP__INCLUDED
+
+// Args include.
+#include "cmd_line.hpp"
+#include "exceptions.hpp"
+#include "parse_result.hpp"
+#include "types.hpp"
+
+// C++ include.
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// parseBatchLines
+//
+
+/*!
+    Parse lines claiming them in chunks from the shared counter, so
+    threads that got short lines take more chunks.
+*/
+static inline void parseBatchLines(const CmdLine &cmdLine,
+                                   const std::vector<const StringList *> &lines,
+                                   std::vector<ParseResult> &results,
+                                   std::atomic<std::size_t> &next,
+                                   std::size_t chunkSize)
+{
+    const std::size_t count = lines.size();
+
+    for (std::size_t first = next.fetch_add(chunkSize); first < count; first = next.fetch_add(chunkSize)) {
+        const std::size_t last = std::min(first + chunkSize, count);
+
+        for (std::size_t i = first; i < last; ++i) {
+            results[i] = cmdLine.parseToResult(*lines[i]);
+        }
+    }
+} // parseBatchLines
+
+} /* namespace details */
+
+//
+// parseBatch
+//
+
+/*!
+    Parse many command lines with the same CmdLine on the given count of
+    threads, the calling thread is one of them.
+
+    Each line is a list of words without the executable name. Results are
+    in the order of the lines, error of each line is in its result.
+
+    \note CmdLine should be frozen with CmdLine::freeze(). Lines are not
+        copied, so they should outlive the results.
+
+    \throw BaseException if CmdLine is not frozen.
+*/
+template<typename Iterator>
+std::vector<ParseResult> parseBatch(
+    //! Parser.
+    const CmdLine &cmdLine,
+    //! First line.
+    Iterator first,
+    //! End of the lines.
+    Iterator last,
+    //! Count of threads, 0 means count of hardware threads.
+    std::size_t threadsCount = 0,
+    //! Count of lines taken by a thread at once.
+    std::size_t chunkSize = 64)
+{
+    if (!cmdLine.isFrozen()) {
+        ARGS_THROW(BaseException(
+            String(SL("Command line parser should be frozen "
+                      "before parsing to the result."))));
+    }
+
+    std::vector<const StringList *> lines;
+
+    for (; first != last; ++first) {
+        const StringList &line = *first;
+
+        lines.push_back(&line);
+    }
+
+    std::vector<ParseResult> results(lines.size());
+
+    if (lines.empty()) {
+        return results;
+    }
+
+    if (!threadsCount) {
+        threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    chunkSize = std::max(chunkSize, static_cast<std::size_t>(1));
+
+    threadsCount = std::min(threadsCount, (lines.size() + chunkSize - 1) / chunkSize);
+
+    std::atomic<std::size_t> next(0);
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount - 1);
+
+    for (std::size_t i = 1; i < threadsCount; ++i) {
+        threads.emplace_back([&]() {
+            details::parseBatchLines(cmdLine, lines, results, next, chunkSize);
+        });
+    }
+
+    details::parseBatchLines(cmdLine, lines, results, next, chunkSize);
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    return results;
+}
+
+//! Parse many command lines with the same CmdLine, see parseBatch() above.
+template<typename Container>
+std::vector<ParseResult> parseBatch(const CmdLine &cmdLine,
+                                    const Container &lines,
+                                    std::size_t threadsCount = 0,
+                                    std::size_t chunkSize = 64)
+{
+    return parseBatch(cmdLine, lines.cbegin(), lines.cend(), threadsCount, chunkSize);
+}
+
+} /* namespace Args */
+
+#endif // ARGS__BATCH_HPP__INCLUDED
@@ -0,0 +1,693 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__CHOICE_ARG_HPP__INCLUDED
+#define ARGS__CHOICE_ARG_HPP__INCLUDED
+
+// Args include.
+#include "arg.hpp"
+#include "context.hpp"
+#include "exceptions.hpp"
+#include "multi_arg.hpp"
+#include "parse_error.hpp"
+#include "static_schema.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include "value_utils.hpp"
+
+// C++ include.
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Args
+{
+
+//
+// Choice
+//
+
+//! One of the allowed values of ChoiceArg or ChoiceSetArg.
+template<typename E>
+struct Choice {
+    //! Value in the command line.
+    const details::LiteralChar *m_name;
+    //! Parsed value.
+    E m_value;
+}; // struct Choice
+
+//! \return Choice with the given name and value.
+template<typename E>
+constexpr Choice<E> makeChoice(const details::LiteralChar *name,
+                               E value)
+{
+    return Choice<E>{name, value};
+}
+
+//
+// ChoiceTableError
+//
+
+//! Error found in the ChoiceTable.
+enum class ChoiceTableError {
+    //! Table is correct.
+    NoError = 0,
+    //! Choice with empty name.
+    EmptyName,
+    //! Two choices with the same name.
+    NameRedefinition,
+    //! Perfect hash for the names wasn't found.
+    PerfectHashNotFound
+}; // enum class ChoiceTableError
+
+//
+// ChoiceTable
+//
+
+/*!
+    ChoiceTable is a set of allowed values known at compile time.
+
+    Names are looked up with perfect hash built at compile time. Use
+    ARGS_CHOICES macro to declare the table, this macro turns errors in
+    the table into static_assert failures.
+*/
+template<typename E,
+         std::size_t N>
+class ChoiceTable final
+{
+    static_assert(N > 0, "Choice table should have at least one choice.");
+
+public:
+    template<typename... T>
+    constexpr explicit ChoiceTable(const T &...choices)
+        : m_choices{choices...}
+        , m_error(ChoiceTableError::NoError)
+        , m_errorChoice(0)
+        , m_names()
+    {
+        static_assert(sizeof...(T) == N, "Wrong count of choices in choice table.");
+
+        validate();
+
+        if (m_error == ChoiceTableError::NoError) {
+            const std::size_t failed = m_names.build(*this);
+
+            if (failed != N) {
+                setError(ChoiceTableError::PerfectHashNotFound, failed);
+            }
+        }
+    }
+
+    //! \return Count of choices.
+    constexpr std::size_t size() const
+    {
+        return N;
+    }
+
+    //! \return Choice with the given index.
+    constexpr const Choice<E> &choice(std::size_t i) const
+    {
+        return m_choices[i];
+    }
+
+    //! \return Error in the table.
+    constexpr ChoiceTableError error() const
+    {
+        return m_error;
+    }
+
+    //! \return Index of the choice with error.
+    constexpr std::size_t errorChoice() const
+    {
+        return m_errorChoice;
+    }
+
+    //! \return Index of the choice with the given name, -1 if there is no such choice.
+    template<typename Iterator>
+    int indexOf(Iterator first,
+                Iterator last) const
+    {
+        const int i = m_names.candidate(first, last);
+
+        return (i >= 0 && details::isEqualToLiteral(first, last, m_choices[i].m_name) ? i : -1);
+    }
+
+private:
+    friend class details::PerfectHash<N>;
+
+    //! Check correctness of the choices.
+    constexpr void validate()
+    {
+        for (std::size_t i = 0; i < N && m_error == ChoiceTableError::NoError; ++i) {
+            if (!details::literalLength(m_choices[i].m_name)) {
+                setError(ChoiceTableError::EmptyName, i);
+            } else {
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (details::isEqualLiterals(m_choices[i].m_name, m_choices[j].m_name)) {
+                        setError(ChoiceTableError::NameRedefinition, i);
+
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    //! Set error.
+    constexpr void setError(ChoiceTableError e,
+                            std::size_t i)
+    {
+        m_error = e;
+        m_errorChoice = i;
+    }
+
+    //! \return Name of the choice with the given index, key of the perfect hash.
+    constexpr const details::LiteralChar *key(std::size_t i) const
+    {
+        return m_choices[i].m_name;
+    }
+
+private:
+    //! Choices.
+    Choice<E> m_choices[N];
+    //! Error.
+    ChoiceTableError m_error;
+    //! Index of the choice with error.
+    std::size_t m_errorChoice;
+    //! Perfect hash of the names.
+    details::PerfectHash<N> m_names;
+}; // class ChoiceTable
+
+//
+// makeChoiceTable
+//
+
+//! \return Choice table with the given choices.
+template<typename E,
+         typename... T>
+constexpr ChoiceTable<E, sizeof...(T) + 1> makeChoiceTable(const Choice<E> &choice,
+                                                           const T &...choices)
+{
+    return ChoiceTable<E, sizeof...(T) + 1>(choice, choices...);
+}
+
+//
+// ARGS_CHOICES
+//
+
+//! Declare constexpr choice table with the given name and check it at compile time.
+#define ARGS_CHOICES(Name, ...)                                                                                        \
+    constexpr auto Name = ::Args::makeChoiceTable(__VA_ARGS__);                                                        \
+    static_assert(Name.error() != ::Args::ChoiceTableError::EmptyName, "Choices with empty name are disallowed.");     \
+    static_assert(Name.error() != ::Args::ChoiceTableError::NameRedefinition,                                          \
+                  "Redefinition of choice with name in choice table.");                                                \
+    static_assert(Name.error() != ::Args::ChoiceTableError::PerfectHashNotFound,                                       \
+                  "Unable to build perfect hash for choice table.");
+
+namespace details
+{
+
+//
+// ChoicesRef
+//
+
+//! Reference to the ChoiceTable of any size.
+template<typename E>
+class ChoicesRef final
+{
+public:
+    template<std::size_t N>
+    explicit ChoicesRef(const ChoiceTable<E, N> &table)
+        : m_table(&table)
+        , m_size(N)
+        , m_choice(&choiceOf<N>)
+        , m_indexOf(&indexOf<N>)
+    {
+    }
+
+    //! \return Count of choices.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    //! \return Choice with the given index.
+    const Choice<E> &choice(std::size_t i) const
+    {
+        return m_choice(m_table, i);
+    }
+
+    //! \return Index of the choice with the given name, -1 if there is no such choice.
+    int indexOf(const Char *first,
+                const Char *last) const
+    {
+        return m_indexOf(m_table, first, last);
+    }
+
+    //! \return Names of the choices separated with "|".
+    String names() const
+    {
+        String res;
+
+        for (std::size_t i = 0; i < m_size; ++i) {
+            if (i) {
+                res.push_back(Char(SL('|')));
+            }
+
+            res.append(String(choice(i).m_name));
+        }
+
+        return res;
+    }
+
+private:
+    template<std::size_t N>
+    static const Choice<E> &choiceOf(const void *table,
+                                     std::size_t i)
+    {
+        return static_cast<const ChoiceTable<E, N> *>(table)->choice(i);
+    }
+
+    template<std::size_t N>
+    static int indexOf(const void *table,
+                       const Char *first,
+                       const Char *last)
+    {
+        return static_cast<const ChoiceTable<E, N> *>(table)->indexOf(first, last);
+    }
+
+private:
+    //! Table.
+    const void *m_table;
+    //! Count of choices.
+    std::size_t m_size;
+    //! Access to the choice of the table.
+    const Choice<E> &(*m_choice)(const void *, std::size_t);
+    //! Lookup in the table.
+    int (*m_indexOf)(const void *, const Char *, const Char *);
+}; // class ChoicesRef
+
+//
+// ChoiceMask
+//
+
+//! Type of the set of choices, underlying type of the enum.
+template<typename E,
+         bool = std::is_enum<E>::value>
+struct ChoiceMask {
+    using type = typename std::underlying_type<E>::type;
+}; // struct ChoiceMask
+
+template<typename E>
+struct ChoiceMask<E, false> {
+    using type = E;
+}; // struct ChoiceMask
+
+} /* namespace details */
+
+//
+// ChoiceArg
+//
+
+/*!
+    Argument with one value from the ChoiceTable, i.e. "--mode fast".
+
+    Value is looked up in the table once on parsing, value that is not
+    in the table is reported as ParseErrorCode::InvalidValue. Value
+    specifier is set to the names of the choices, so they are in the help.
+
+    \note Table should outlive the argument, i.e. should be declared
+        with ARGS_CHOICES at namespace scope.
+*/
+template<typename E>
+class ChoiceArg : public Arg
+{
+public:
+    //! Construct argument with flag and name.
+    template<typename Name,
+             std::size_t N>
+    ChoiceArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Name for this argument.
+        Name &&name,
+        //! Allowed values.
+        const ChoiceTable<E, N> &choices,
+        //! Is this argument required?
+        bool isRequired = false)
+        : Arg(flag,
+              std::forward<Name>(name),
+              true,
+              isRequired)
+        , m_choices(choices)
+        , m_choice()
+        , m_defaultChoice()
+    {
+        setValueSpecifier(m_choices.names());
+    }
+
+    //! Construct argument only with flag, without name.
+    template<std::size_t N>
+    ChoiceArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Allowed values.
+        const ChoiceTable<E, N> &choices,
+        //! Is this argument required?
+        bool isRequired = false)
+        : Arg(flag,
+              true,
+              isRequired)
+        , m_choices(choices)
+        , m_choice()
+        , m_defaultChoice()
+    {
+        setValueSpecifier(m_choices.names());
+    }
+
+    //! Construct argument only with name, without flag.
+    template<typename Name,
+             std::size_t N>
+    ChoiceArg(
+        //! Name for this argument.
+        Name &&name,
+        //! Allowed values.
+        const ChoiceTable<E, N> &choices,
+        //! Is this argument required?
+        bool isRequired = false)
+        : Arg(std::forward<Name>(name),
+              true,
+              isRequired)
+        , m_choices(choices)
+        , m_choice()
+        , m_defaultChoice()
+    {
+        setValueSpecifier(m_choices.names());
+    }
+
+    virtual ~ChoiceArg()
+    {
+    }
+
+    //! \return Chosen value or default value.
+    E choice() const
+    {
+        return (isDefined() ? m_choice : m_defaultChoice);
+    }
+
+    /*!
+        Set default value.
+
+        \throw BaseException if the value is not in the table.
+    */
+    ChoiceArg &setDefaultValue(const String &v) override
+    {
+        const int i = m_choices.indexOf(v.data(), v.data() + v.size());
+
+        if (i < 0) {
+            ARGS_THROW(BaseException(String(SL("Invalid default value \""))
+                                     + v
+                                     + SL("\" of argument \"")
+                                     + name()
+                                     + SL("\".")));
+        }
+
+        m_defaultChoice = m_choices.choice(static_cast<std::size_t>(i)).m_value;
+
+        Arg::setDefaultValue(v);
+
+        return *this;
+    }
+
+    //! \return Is the given string in the table?
+    bool isValueValid(const String &value) const override
+    {
+        return (m_choices.indexOf(value.data(), value.data() + value.size()) >= 0);
+    }
+
+    //! Clear state of the argument.
+    void clear() override
+    {
+        Arg::clear();
+
+        m_choice = E();
+    }
+
+protected:
+    //! Process argument and look up its value.
+    void process(
+        //! Context of the command line.
+        Context &context) override
+    {
+        const bool wasDefined = isDefined();
+
+        Arg::process(context);
+
+        if (!wasDefined && isDefined()) {
+            const String &v = value();
+            const int i = m_choices.indexOf(v.data(), v.data() + v.size());
+
+            if (i < 0) {
+                details::reportError(cmdLine(), ParseError::invalidValue(this, v));
+            } else {
+                m_choice = m_choices.choice(static_cast<std::size_t>(i)).m_value;
+            }
+        }
+    }
+
+private:
+    DISABLE_COPY(ChoiceArg)
+
+    //! Allowed values.
+    details::ChoicesRef<E> m_choices;
+    //! Chosen value.
+    E m_choice;
+    //! Default value.
+    E m_defaultChoice;
+}; // class ChoiceArg
+
+//
+// ChoiceSetArg
+//
+
+/*!
+    Argument with the set of values from the ChoiceTable, i.e.
+    "--log net,disk,db" or "--log net disk" or both, values of the
+    choices should be bit flags.
+
+    Each value is split on the delimiter and its items are looked up in
+    the table once on parsing and combined into mask(), no strings are
+    made for the items. Value with item that is not in the table is
+    reported as ParseErrorCode::InvalidValue. Value specifier is set to
+    the names of the choices, so they are in the help.
+
+    \note values() of the argument is not filled on parsing, only
+        default values are there.
+
+    \note Table should outlive the argument, i.e. should be declared
+        with ARGS_CHOICES at namespace scope.
+*/
+template<typename E>
+class ChoiceSetArg : public MultiArg
+{
+public:
+    //! Type of the mask, underlying type of the enum.
+    using Mask = typename details::ChoiceMask<E>::type;
+
+    static_assert(std::is_integral<Mask>::value, "ChoiceSetArg supports only enums and integer types.");
+
+    //! Construct argument with flag and name.
+    template<typename Name,
+             std::size_t N>
+    ChoiceSetArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Name for this argument.
+        Name &&name,
+        //! Allowed values.
+        const ChoiceTable<E, N> &choices,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(flag,
+                   std::forward<Name>(name),
+                   true,
+                   isRequired)
+        , m_choices(choices)
+        , m_delimiter(SL(','))
+        , m_mask(0)
+        , m_defaultMask(0)
+    {
+        setValueSpecifier(m_choices.names());
+    }
+
+    //! Construct argument only with flag, without name.
+    template<std::size_t N>
+    ChoiceSetArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Allowed values.
+        const ChoiceTable<E, N> &choices,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(flag,
+                   true,
+                   isRequired)
+        , m_choices(choices)
+        , m_delimiter(SL(','))
+        , m_mask(0)
+        , m_defaultMask(0)
+    {
+        setValueSpecifier(m_choices.names());
+    }
+
+    //! Construct argument only with name, without flag.
+    template<typename Name,
+             std::size_t N>
+    ChoiceSetArg(
+        //! Name for this argument.
+        Name &&name,
+        //! Allowed values.
+        const ChoiceTable<E, N> &choices,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(std::forward<Name>(name),
+                   true,
+                   isRequired)
+        , m_choices(choices)
+        , m_delimiter(SL(','))
+        , m_mask(0)
+        , m_defaultMask(0)
+    {
+        setValueSpecifier(m_choices.names());
+    }
+
+    virtual ~ChoiceSetArg()
+    {
+    }
+
+    //! \return Delimiter of the items.
+    Char delimiter() const
+    {
+        return m_delimiter;
+    }
+
+    //! Set delimiter of the items, "," by default.
+    ChoiceSetArg &setDelimiter(Char d)
+    {
+        m_delimiter = d;
+        return *this;
+    }
+
+    //! \return Mask of the chosen values or default mask.
+    Mask mask() const
+    {
+        return (isDefined() ? m_mask : m_defaultMask);
+    }
+
+    //! \return Is the given value chosen?
+    bool isChosen(E value) const
+    {
+        return ((mask() & static_cast<Mask>(value)) != 0);
+    }
+
+    /*!
+        Set default value, it's split on the delimiter too.
+        \note Items will be added to the default mask.
+
+        \throw BaseException if any item is not in the table.
+    */
+    ChoiceSetArg &setDefaultValue(const String &v) override
+    {
+        if (!parseSet(v.data(), v.data() + v.size(), m_defaultMask)) {
+            ARGS_THROW(BaseException(String(SL("Invalid default value \""))
+                                     + v
+                                     + SL("\" of argument \"")
+                                     + name()
+                                     + SL("\".")));
+        }
+
+        MultiArg::setDefaultValue(v);
+
+        return *this;
+    }
+
+    //! \return Are all items of the given string in the table?
+    bool isValueValid(const String &value) const override
+    {
+        Mask tmp = 0;
+
+        return parseSet(value.data(), value.data() + value.size(), tmp);
+    }
+
+    //! Clear state of the argument.
+    void clear() override
+    {
+        MultiArg::clear();
+
+        m_mask = 0;
+    }
+
+protected:
+    //! Process argument and look up items of all its values.
+    void process(
+        //! Context of the command line.
+        Context &context) override
+    {
+        details::convertValues(context, this, cmdLine(), [this](const details::StringView &word) {
+            return parseSet(word.begin(), word.end(), m_mask);
+        });
+    }
+
+private:
+    /*!
+        Add items of the given range to \a mask.
+
+        \return false if any item is not in the table, \a mask isn't changed then.
+    */
+    bool parseSet(const Char *first,
+                  const Char *last,
+                  Mask &mask) const
+    {
+        Mask res = 0;
+
+        for (;;) {
+            const Char *end = std::find(first, last, m_delimiter);
+            const int i = m_choices.indexOf(first, end);
+
+            if (i < 0) {
+                return false;
+            }
+
+            res = static_cast<Mask>(res | static_cast<Mask>(m_choices.choice(static_cast<std::size_t>(i)).m_value));
+
+            if (end == last) {
+                mask = static_cast<Mask>(mask | res);
+
+                return true;
+            }
+
+            first = end + 1;
+        }
+    }
+
+private:
+    DISABLE_COPY(ChoiceSetArg)
+
+    //! Allowed values.
+    details::ChoicesRef<E> m_choices;
+    //! Delimiter of the items.
+    Char m_delimiter;
+    //! Mask of the chosen values.
+    Mask m_mask;
+    //! Default mask.
+    Mask m_defaultMask;
+}; // class ChoiceSetArg
+
+} /* namespace Args */
+
+#endif // ARGS__CHOICE_ARG_HPP__INCLUDED
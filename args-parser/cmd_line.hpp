@@ -10,13 +10,24 @@
 // Args include.
 #include "api.hpp"
 #include "command.hpp"
+#include "config_file.hpp"
 #include "context.hpp"
+#include "environment.hpp"
 #include "exceptions.hpp"
 #include "help.hpp"
+#include "name_index.hpp"
+#include "nul_stream.hpp"
+#include "parse_error.hpp"
+#include "parse_handler_iface.hpp"
+#include "parse_result.hpp"
+#include "positional_sink_iface.hpp"
+#include "static_arg.hpp"
 #include "utils.hpp"
+#include "values_view.hpp"
 
 // C++ include.
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -30,8 +41,43 @@ namespace details
 // makeContext
 //
 
+#ifdef ARGS_QSTRING_BUILD
 //! Make context from the argc and argv.
-static inline ContextInternal
+static inline ContextInternal makeContext(int argc,
+                                          const char *const *argv)
+{
+    ContextInternal context;
+
+    // We skip first argv because of it's executable name.
+    for (int i = 1; i < argc; ++i) {
+        context.push_back(argv[i]);
+    }
+
+    return context;
+} // makeContext
+
+//! Make context owning copies of the argc and argv.
+static inline ContextInternal copyContext(int argc,
+                                          const char *const *argv)
+{
+    return makeContext(argc, argv);
+} // copyContext
+
+//! Make context with views to the given strings.
+static inline ContextView makeContext(const QStringList &args)
+{
+    ContextView context;
+    context.reserve(static_cast<std::size_t>(args.size()));
+
+    for (const auto &arg : args) {
+        context.push_back(StringView(arg.constData(), static_cast<std::size_t>(arg.length())));
+    }
+
+    return context;
+} // makeContext
+#else
+//! Make context with views to the argc and argv.
+static inline ContextView
 #ifdef ARGS_WSTRING_BUILD
 makeContext(int argc,
             const Char *const *argv)
@@ -39,12 +85,50 @@ makeContext(int argc,
 makeContext(int argc,
             const char *const *argv)
 #endif
+{
+    ContextView context;
+
+    if (argc > 1) {
+        context.reserve(static_cast<std::size_t>(argc - 1));
+    }
+
+    // We skip first argv because of it's executable name.
+    for (int i = 1; i < argc; ++i) {
+        context.push_back(StringView(argv[i]));
+    }
+
+    return context;
+} // makeContext
+
+//! Make context owning copies of the argc and argv.
+static inline ContextInternal
+#ifdef ARGS_WSTRING_BUILD
+copyContext(int argc,
+            const Char *const *argv)
+#else
+copyContext(int argc,
+            const char *const *argv)
+#endif
 {
     ContextInternal context;
 
     // We skip first argv because of it's executable name.
     for (int i = 1; i < argc; ++i) {
-        context.push_back(argv[i]);
+        context.push_back(String(argv[i]));
+    }
+
+    return context;
+} // copyContext
+#endif
+
+//! Make context with views to the given strings.
+static inline ContextView makeContext(const StringList &args)
+{
+    ContextView context;
+    context.reserve(static_cast<std::size_t>(args.size()));
+
+    for (const auto &arg : args) {
+        context.push_back(arg);
     }
 
     return context;
@@ -78,6 +162,9 @@ static inline String formatCorrectNamesString(const StringList &names)
     }
 }
 
+class ArgsSink;
+class ResultSink;
+
 } /* namespace details */
 
 //
@@ -96,6 +183,9 @@ using ArgPtrToAPI = std::unique_ptr<ArgIface, details::Deleter<ArgIface>>;
 */
 class CmdLine final : public CmdLineAPI<CmdLine, CmdLine, ArgPtrToAPI>
 {
+    friend class ArgIface;
+    friend class Command;
+
 public:
     //! Smart pointer to the argument.
     using ArgPtr = ArgPtrToAPI;
@@ -109,7 +199,26 @@ public:
         //! Command should be defined.
         CommandIsRequired = 1,
         //! Handle positional arguments.
-        HandlePositionalArguments = 2
+        HandlePositionalArguments = 2,
+        //! Allow unique prefixes of names of arguments and commands, i.e. "--verb" for "--verbose".
+        AllowAbbreviations = 4,
+        //! Place arguments created with API into the arena owned by CmdLine.
+        UseArena = 8,
+        /*!
+            Replace "@file" words with the words of the response files
+            like GCC does, file that can't be read is kept as is.
+            Words are viewed in the mapped file, so the parsed words
+            keep the file mapped.
+
+            \note Index of the word in the errors is the index in the
+                expanded words then.
+        */
+        ExpandResponseFiles = 16,
+        /*!
+            Don't copy argv given to the constructor, words are viewed
+            in place, so argv should outlive parsing.
+        */
+        BorrowArguments = 32
     }; // enum CmdLineOpt
 
     //! Storage of command line options.
@@ -122,19 +231,27 @@ public:
                        ArgPtr,
                        true>(*this,
                              *this)
-        , m_command(nullptr)
-        , m_currCommand(nullptr)
+        , m_arena(opt & UseArena ? new details::Arena : nullptr)
         , m_opt(opt)
+        , m_positionalSink(nullptr)
+        , m_generation(1)
+        , m_frozenGeneration(0)
+        , m_indexGeneration(0)
+        , m_treeIndexGeneration(0)
+        , m_argsCount(0)
+        , m_throwOnError(true)
     {
     }
 
 #ifdef ARGS_WSTRING_BUILD
     //! Construct CmdLine with set command line arguments.
+    //! \note argv is copied unless BorrowArguments is set.
     CmdLine(int argc,
             const Char *const *argv,
             CmdLineOpts opt = Empty);
 #else
     //! Construct CmdLine with set command line arguments.
+    //! \note argv is copied unless BorrowArguments is set.
     CmdLine(int argc,
             const char *const *argv,
             CmdLineOpts opt = Empty);
@@ -163,8 +280,12 @@ public:
             arg->setCmdLine(this);
 
             m_args.push_back(std::move(arg));
+
+            argumentAdded(m_args.back().get());
         } else {
-            throw BaseException(String(SL("Argument \"")) + arg->name() + SL("\" already in the command line parser."));
+            ARGS_THROW(BaseException(String(SL("Argument \""))
+                                     + arg->name()
+                                     + SL("\" already in the command line parser.")));
         }
         return *this;
     }
@@ -182,17 +303,354 @@ public:
                const char *const *argv)
 #endif
     {
-        m_context = std::move(details::makeContext(argc, argv));
+        m_context = details::makeContext(argc, argv);
+
+        parse();
+    }
+
+    //! Parse arguments. \note Arguments are not copied, so they should outlive parsing.
+    void parse(const StringList &args)
+    {
+        m_context = details::makeContext(args);
+
+        parse();
+    }
+
+#ifdef ARGS_QSTRING_BUILD
+    //! Parse arguments. \note Arguments are not copied, so they should outlive parsing.
+    void parse(const QStringList &args)
+    {
+        m_context = details::makeContext(args);
 
         parse();
     }
+#endif
+
+    /*!
+        Parse arguments without throwing on errors in the command line.
+
+        \return Error of the parsing, it's false on success.
+
+        \note Errors in the definitions of the arguments, i.e.
+            redefinition of the flag, are still thrown.
+    */
+    ParseError tryParse();
+
+#ifdef ARGS_WSTRING_BUILD
+    //! Parse arguments without throwing on errors in the command line.
+    ParseError tryParse(int argc,
+                        const Char *const *argv)
+#else
+    //! Parse arguments without throwing on errors in the command line.
+    ParseError tryParse(int argc,
+                        const char *const *argv)
+#endif
+    {
+        m_context = details::makeContext(argc, argv);
+
+        return tryParse();
+    }
+
+    //! Parse arguments without throwing on errors in the command line.
+    //! \note Arguments are not copied, so they should outlive parsing.
+    ParseError tryParse(const StringList &args)
+    {
+        m_context = details::makeContext(args);
+
+        return tryParse();
+    }
+
+#ifdef ARGS_QSTRING_BUILD
+    //! Parse arguments without throwing on errors in the command line.
+    //! \note Arguments are not copied, so they should outlive parsing.
+    ParseError tryParse(const QStringList &args)
+    {
+        m_context = details::makeContext(args);
+
+        return tryParse();
+    }
+#endif
+
+    /*!
+        Parse words separated with NUL characters read from the file
+        descriptor, i.e. "find -print0 | program", instead of the words
+        of the command line. File descriptor isn't closed.
+
+        Words are read with chunks and fed to the parser while parsing,
+        so memory doesn't depend on the count of the words if positional
+        arguments are passed to the sink, see setPositionalSink().
+        Argument with many values takes values from the words read so
+        far, i.e. at least details::NulStream::c_lookAhead next words.
+
+        \note Response files aren't expanded in the stream.
+    */
+    void parseStream(int fd);
+
+    //! Parse words read from the file descriptor without throwing on errors, see parseStream().
+    ParseError tryParseStream(int fd);
+
+#ifdef ARGS_WSTRING_BUILD
+    /*!
+        Parse arguments into the result without changing the arguments.
+
+        CmdLine should be frozen with freeze() and not changed after
+        that. Then any count of threads can parse with the same CmdLine
+        simultaneously, but not simultaneously with parse() or
+        tryParse().
+
+        Help isn't printed and process() of the arguments isn't
+        invoked. If help is met the rest of the words are the values of
+        the help and arguments aren't checked after parsing.
+
+        \note argv is not copied, so it should outlive the result.
+
+        \throw BaseException if CmdLine is not frozen.
+    */
+    ParseResult parseToResult(int argc,
+                              const Char *const *argv) const
+#else
+    /*!
+        Parse arguments into the result without changing the arguments.
+
+        CmdLine should be frozen with freeze() and not changed after
+        that. Then any count of threads can parse with the same CmdLine
+        simultaneously, but not simultaneously with parse() or
+        tryParse().
+
+        Help isn't printed and process() of the arguments isn't
+        invoked. If help is met the rest of the words are the values of
+        the help and arguments aren't checked after parsing.
+
+        \note argv is not copied, so it should outlive the result.
+
+        \throw BaseException if CmdLine is not frozen.
+    */
+    ParseResult parseToResult(int argc,
+                              const char *const *argv) const
+#endif
+    {
+        ParseResult result;
+
+#ifdef ARGS_QSTRING_BUILD
+        result.m_words = details::makeContext(argc, argv);
+
+        Context context(details::makeContext(result.m_words));
+#else
+        Context context(details::makeContext(argc, argv));
+#endif
+
+        parseContext(context, result);
+
+        return result;
+    }
+
+    //! Parse arguments into the result without changing the arguments.
+    //! \note Arguments are not copied, so they should outlive the result.
+    ParseResult parseToResult(const StringList &args) const
+    {
+        ParseResult result;
+
+        Context context(details::makeContext(args));
+
+        parseContext(context, result);
+
+        return result;
+    }
+
+#ifdef ARGS_QSTRING_BUILD
+    //! Parse arguments into the result without changing the arguments.
+    //! \note Arguments are not copied, so they should outlive the result.
+    ParseResult parseToResult(const QStringList &args) const
+    {
+        ParseResult result;
+
+        Context context(details::makeContext(args));
+
+        parseContext(context, result);
+
+        return result;
+    }
+#endif
+
+#ifdef ARGS_WSTRING_BUILD
+    /*!
+        Parse arguments passing the events of the parsing to the handler
+        in the order of the words, see ParseHandlerIface.
+
+        Works like parseToResult(), but values and positional arguments
+        are passed only to the handler and the result keeps only what
+        is defined, so requirements of the arguments and the groups are
+        still checked.
+
+        \note argv is not copied, so it should outlive the result.
+
+        \throw BaseException if CmdLine is not frozen.
+    */
+    ParseResult parseToHandler(int argc,
+                               const Char *const *argv,
+                               ParseHandlerIface &handler) const
+#else
+    /*!
+        Parse arguments passing the events of the parsing to the handler
+        in the order of the words, see ParseHandlerIface.
+
+        Works like parseToResult(), but values and positional arguments
+        are passed only to the handler and the result keeps only what
+        is defined, so requirements of the arguments and the groups are
+        still checked.
+
+        \note argv is not copied, so it should outlive the result.
+
+        \throw BaseException if CmdLine is not frozen.
+    */
+    ParseResult parseToHandler(int argc,
+                               const char *const *argv,
+                               ParseHandlerIface &handler) const
+#endif
+    {
+        ParseResult result;
+
+#ifdef ARGS_QSTRING_BUILD
+        result.m_words = details::makeContext(argc, argv);
+
+        Context context(details::makeContext(result.m_words));
+#else
+        Context context(details::makeContext(argc, argv));
+#endif
+
+        parseContext(context, result, &handler);
+
+        return result;
+    }
+
+    //! Parse arguments passing the events of the parsing to the handler.
+    //! \note Arguments are not copied, so they should outlive the result.
+    ParseResult parseToHandler(const StringList &args,
+                               ParseHandlerIface &handler) const
+    {
+        ParseResult result;
+
+        Context context(details::makeContext(args));
+
+        parseContext(context, result, &handler);
+
+        return result;
+    }
+
+#ifdef ARGS_QSTRING_BUILD
+    //! Parse arguments passing the events of the parsing to the handler.
+    //! \note Arguments are not copied, so they should outlive the result.
+    ParseResult parseToHandler(const QStringList &args,
+                               ParseHandlerIface &handler) const
+    {
+        ParseResult result;
+
+        Context context(details::makeContext(args));
+
+        parseContext(context, result, &handler);
+
+        return result;
+    }
+#endif
+
+    /*!
+        Check correctness of the arguments and build lookup structures
+        now. Result is kept until the tree of the arguments is changed,
+        i.e. with addArg(), so repeated parsing doesn't check the
+        arguments again.
+
+        \throw BaseException if the arguments are defined incorrectly.
+    */
+    void freeze();
+
+    //! \return Were the arguments checked and not changed since that?
+    bool isFrozen() const
+    {
+        return (m_frozenGeneration == m_generation);
+    }
 
-    //! \return Positional arguments.
+    //! \return Positional arguments, empty if positional sink is set.
     const StringList &positional() const
     {
         return m_positional;
     }
 
+    //! \return Receiver of positional arguments or nullptr.
+    PositionalSinkIface *positionalSink() const
+    {
+        return m_positionalSink;
+    }
+
+    /*!
+        Set receiver of positional arguments found with parse() and
+        tryParse(), nullptr to keep them in positional().
+
+        \note Developer should handle lifetime of the sink.
+        \note parseToResult() keeps positional arguments in the result.
+    */
+    CmdLine &setPositionalSink(PositionalSinkIface *sink)
+    {
+        m_positionalSink = sink;
+        return *this;
+    }
+
+    //! \return Name of the config file or empty string.
+    String configFile() const
+    {
+        return (m_configFile ? m_configFile->name() : String());
+    }
+
+    /*!
+        Set config file with "key = value" lines, empty name to remove it.
+
+        Keys are names of the arguments of the top level, i.e. "verbose",
+        "--verbose", "v" or "-v". Values are applied when the command line
+        is parsed to arguments and commands not defined in the command line,
+        i.e. command line overrides the file. Argument gets the value of the
+        last line with its key, MultiArg gets values of all lines. Value of
+        argument without value may be "true", "yes", "on", "1", empty or
+        "false", "no", "off", "0". Environment variables bound with
+        Arg::setEnvVar() override the file.
+
+        File is read here once and kept for all the parsings. Unknown key is
+        reported on parsing as ParseErrorCode::UnknownConfigKey.
+
+        \throw BaseException if the file can't be read or has an invalid line.
+    */
+    CmdLine &setConfigFile(const String &fileName)
+    {
+        if (fileName.empty()) {
+            m_configFile.reset();
+
+            return *this;
+        }
+
+        auto file = std::make_shared<details::ConfigFile>();
+        details::StringView invalid;
+
+        if (!file->open(fileName, invalid)) {
+            if (invalid.empty()) {
+                ARGS_THROW(BaseException(String(SL("Unable to read config file \"")) + fileName + SL("\".")));
+            }
+
+            ARGS_THROW(BaseException(String(SL("Invalid line \"")) + invalid.toString() + SL("\" in config file \"")
+                                     + fileName + SL("\".")));
+        }
+
+        m_configFile = std::move(file);
+
+        return *this;
+    }
+
+    /*!
+        \return Processed arguments of the last parsing in the order of
+        the occurrence. Argument is here as many times as it was met.
+    */
+    const std::vector<Occurrence> &occurrences() const
+    {
+        return m_state.m_occurrences;
+    }
+
     //! \return Positional string description for the help.
     const String &positionalDescription() const
     {
@@ -210,59 +668,37 @@ public:
     //! \note It's impossible to find any GroupIface with exception of Command.
     ArgIface *findArgument(const String &name)
     {
-        auto it = std::find_if(m_args.begin(), m_args.end(), [&name](const auto &arg) -> bool {
-            return (arg->findArgument(name) != nullptr);
-        });
-
-        if (it != m_args.end()) {
-            if ((*it)->type() == ArgType::Command) {
-                return it->get();
-            } else {
-                return (*it)->findArgument(name);
-            }
-        } else if (!m_prevCommand.empty()) {
-            for (const auto &c : m_prevCommand) {
-                ArgIface *tmp = c->findChild(name);
-
-                if (tmp) {
-                    return tmp;
-                }
-            }
-        }
-
-        return nullptr;
+        return lookup(name, m_state);
     }
 
     //! \return Argument for the given name.
     //! \note It's impossible to find any GroupIface with exception of Command.
     const ArgIface *findArgument(const String &name) const
     {
-        auto it = std::find_if(m_args.cbegin(), m_args.cend(), [&name](const auto &arg) -> bool {
-            return (arg->findArgument(name) != nullptr);
-        });
-
-        if (it != m_args.end()) {
-            if ((*it)->type() == ArgType::Command) {
-                return it->get();
-            } else {
-                return (*it)->findArgument(name);
-            }
-        } else if (!m_prevCommand.empty()) {
-            for (const auto &c : m_prevCommand) {
-                ArgIface *tmp = c->findChild(name);
+        return lookup(name, m_state);
+    }
 
-                if (tmp) {
-                    return tmp;
-                }
-            }
-        }
+    //! \return Argument for the given name, the name isn't copied.
+    const ArgIface *findArgument(const details::StringView &name) const
+    {
+        return lookup(name, m_state);
+    }
 
-        return nullptr;
+    //! \return Argument for the given flag without leading dash in the current scope.
+    const ArgIface *findFlag(Char flag) const
+    {
+        return findFlag(flag, m_state);
     }
 
     //! \return All arguments.
     const Arguments &arguments() const;
 
+    //! \return Arena for the arguments created with API or nullptr.
+    details::Arena *arena() const
+    {
+        return m_arena.get();
+    }
+
     //! \return Is given name a misspelled name of the argument.
     bool isMisspelledName(
         //! Name to check (misspelled).
@@ -270,22 +706,7 @@ public:
         //! List of possible names for the given misspelled name.
         StringList &possibleNames) const
     {
-        bool ret = false;
-
-        std::for_each(arguments().cbegin(), arguments().cend(), [&](const auto &arg) {
-            if (arg->type() == ArgType::Command) {
-                if (arg.get() == m_command) {
-                    if (arg->isMisspelledName(name, possibleNames))
-                        ret = true;
-                } else if (static_cast<Command *>(arg.get())->isMisspelledCommand(name, possibleNames)) {
-                    ret = true;
-                }
-            } else if (arg->isMisspelledName(name, possibleNames)) {
-                ret = true;
-            }
-        });
-
-        return ret;
+        return isMisspelledName(name, possibleNames, m_state);
     }
 
     //! Add help.
@@ -301,8 +722,7 @@ public:
         //! Positional string in the help.
         const String &posDesc = String())
     {
-        auto help = std::unique_ptr<Help, details::Deleter<ArgIface>>(new Help(throwExceptionOnPrint),
-                                                                      details::Deleter<ArgIface>(true));
+        auto help = details::makeArg<Help>(arena(), throwExceptionOnPrint);
 
         if (!appExe.empty()) {
             help->setExecutable(appExe);
@@ -332,7 +752,7 @@ public:
                  String::size_type length = 79) = delete;
 
     //! \return Value of the argument.
-    String value(
+    const String &value(
         //! Name of the argument. Should be full name, i.e '-a' or '--arg'
         //! or 'add' if it's a command or subcommand.
         const String &name) const
@@ -351,14 +771,15 @@ public:
                 return (static_cast<const MultiArg *>(arg)->value());
 
             default:
-                return String();
+                return details::DummyString<>::c_string;
             }
         } else {
-            return String();
+            return details::DummyString<>::c_string;
         }
     }
 
     //! \return Values of the argument.
+    //! \note Values are copied, use valuesView() or takeValues() to avoid it.
     StringList values(
         //! Name of the argument. Should be full name, i.e '-a' or '--arg'
         //! or 'add' if it's a command or subcommand.
@@ -385,10 +806,8 @@ public:
         }
     }
 
-    //! \return Is argument defined?
-    //! \note It's impossible to check if any GroupIface is defined
-    //! with exception of Command.
-    bool isDefined(
+    //! \return View to the values of the argument, values are not copied.
+    ValuesView valuesView(
         //! Name of the argument. Should be full name, i.e '-a' or '--arg'
         //! or 'add' if it's a command or subcommand.
         const String &name) const
@@ -396,90 +815,577 @@ public:
         const auto *arg = findArgument(name);
 
         if (arg) {
-            return arg->isDefined();
-        } else {
-            return false;
-        }
-    }
-
-    //! Clear state of the arguments.
-    void clear()
-    {
-        std::for_each(arguments().begin(), arguments().end(), [](const auto &a) {
-            a->clear();
-        });
-
-        m_command = nullptr;
-        m_currCommand = nullptr;
-        m_prevCommand.clear();
-    }
-
-private:
-    //! Check correctness of the arguments before parsing.
-    void checkCorrectnessBeforeParsing() const;
-    //! Check correctness of the arguments after parsing.
-    void checkCorrectnessAfterParsing() const;
+            switch (arg->type()) {
+            case ArgType::Command:
+                return ValuesView(static_cast<const Command *>(arg)->values());
 
-    //! Print information about unknown argument.
-    void printInfoAboutUnknownArgument(const String &word)
-    {
-        StringList correctNames;
+            case ArgType::Arg:
+                return ValuesView(static_cast<const Arg *>(arg)->value());
 
-        if (isMisspelledName(word, correctNames)) {
-            const String names = details::formatCorrectNamesString(correctNames);
+            case ArgType::MultiArg:
+                return ValuesView(static_cast<const MultiArg *>(arg)->values());
 
-            throw BaseException(
-                String(SL("Unknown argument \"")) + word + SL("\".\n\nProbably you mean \"") + names + SL("\"."));
+            default:
+                return ValuesView();
+            }
         } else {
-            throw BaseException(String(SL("Unknown argument \"")) + word + SL("\"."));
+            return ValuesView();
         }
     }
 
-    //! Save all positional arguments
-    void savePositionalArguments(const String &word,
-                                 bool splitted,
-                                 bool valuePrepended)
+    //! \return Values of the argument moved out of the argument.
+    StringList takeValues(
+        //! Name of the argument. Should be full name, i.e '-a' or '--arg'
+        //! or 'add' if it's a command or subcommand.
+        const String &name)
     {
-        auto tmp = word;
-
-        if (splitted) {
-            tmp.append(1, '=');
+        auto *arg = findArgument(name);
+
+        if (arg) {
+            switch (arg->type()) {
+            case ArgType::Command:
+                return static_cast<Command *>(arg)->takeValues();
+
+            case ArgType::Arg:
+                return StringList({static_cast<const Arg *>(arg)->value()});
+
+            case ArgType::MultiArg:
+                return static_cast<MultiArg *>(arg)->takeValues();
+
+            default:
+                return StringList();
+            }
+        } else {
+            return StringList();
+        }
+    }
+
+    //! \return Is argument defined?
+    //! \note It's impossible to check if any GroupIface is defined
+    //! with exception of Command.
+    bool isDefined(
+        //! Name of the argument. Should be full name, i.e '-a' or '--arg'
+        //! or 'add' if it's a command or subcommand.
+        const String &name) const
+    {
+        const auto *arg = findArgument(name);
+
+        if (arg) {
+            return arg->isDefined();
+        } else {
+            return false;
+        }
+    }
+
+    /*!
+        Clear state of the arguments.
+
+        If the arguments weren't changed since the last parsing only
+        the processed arguments are cleared.
+
+        \note State set to the arguments directly, i.e. with
+            Arg::setValue(), is not cleared in this case.
+    */
+    void clear()
+    {
+        if (isFrozen()) {
+            for (const auto &o : m_state.m_occurrences) {
+                if (o.m_arg->type() == ArgType::Command) {
+                    static_cast<Command *>(o.m_arg)->clearState();
+                } else {
+                    o.m_arg->clear();
+                }
+            }
+        } else {
+            std::for_each(arguments().begin(), arguments().end(), [](const auto &a) {
+                a->clear();
+            });
+        }
+
+        m_state.clear();
+    }
+
+private:
+    /*!
+        \return Argument for the given name.
+
+        Top level scope is checked first and then scopes of the
+        active commands from the outermost one.
+    */
+    ArgIface *lookup(const details::StringView &name,
+                     const details::ParseState &state) const
+    {
+        auto *arg = index().find(name);
+
+        for (auto it = state.m_prevCommand.cbegin(), last = state.m_prevCommand.cend(); !arg && it != last; ++it) {
+            arg = (*it)->index().find(name);
+        }
+
+        return arg;
+    }
+
+    //! \return Is given name a misspelled name of the argument in the given state.
+    bool isMisspelledName(const String &name,
+                          StringList &possibleNames,
+                          const details::ParseState &state) const
+    {
+        bool ret = false;
+
+        std::for_each(arguments().cbegin(), arguments().cend(), [&](const auto &arg) {
+            if (arg->type() == ArgType::Command) {
+                if (arg.get() == state.m_command) {
+                    if (arg->isMisspelledName(name, possibleNames))
+                        ret = true;
+                } else if (static_cast<Command *>(arg.get())->isMisspelledCommand(name, possibleNames)) {
+                    ret = true;
+                }
+            } else if (arg->isMisspelledName(name, possibleNames)) {
+                ret = true;
+            }
+        });
+
+        return ret;
+    }
+
+    /*!
+        \return Argument for the given unique prefix of the name or nullptr.
+
+        Names of all active scopes are checked, so prefix should be
+        unique among all of them.
+    */
+    ArgIface *findAbbreviation(const details::StringView &prefix,
+                               const details::ParseState &state) const
+    {
+        ArgIface *found = nullptr;
+
+        return (countAbbreviations(prefix, found, state) == 1 ? found : nullptr);
+    }
+
+    /*!
+        \return Count of the names of active scopes starting with the
+            given prefix, if abbreviations are allowed.
+
+        \a found is set to the argument if the count is 1.
+    */
+    std::size_t countAbbreviations(const details::StringView &prefix,
+                                   ArgIface *&found,
+                                   const details::ParseState &state) const
+    {
+        found = nullptr;
+
+        if (!(m_opt & AllowAbbreviations) || prefix.empty() || prefix == String(2, '-')) {
+            return 0;
+        }
+
+        ArgIface *arg = nullptr;
+
+        std::size_t count = index().trie().find(prefix, found);
+
+        for (const auto &c : state.m_prevCommand) {
+            const std::size_t n = c->index().trie().find(prefix, arg);
+
+            if (n) {
+                count += n;
+                found = arg;
+            }
+        }
+
+        return count;
+    }
+
+    //! Append to \a names all names of active scopes starting with the given prefix.
+    void collectAbbreviations(const String &prefix,
+                              StringList &names,
+                              const details::ParseState &state) const
+    {
+        index().trie().collect(prefix, names);
+
+        for (const auto &c : state.m_prevCommand) {
+            c->index().trie().collect(prefix, names);
+        }
+    }
+
+    //! \return Argument for the given flag without leading dash.
+    ArgIface *findFlag(Char flag,
+                       const details::ParseState &state) const
+    {
+        auto *arg = index().findFlag(flag);
+
+        for (auto it = state.m_prevCommand.cbegin(), last = state.m_prevCommand.cend(); !arg && it != last; ++it) {
+            arg = (*it)->index().findFlag(flag);
+        }
+
+        return arg;
+    }
+
+    //! \return Index of the names of top level arguments.
+    const details::NameIndex &index() const
+    {
+        if (m_indexGeneration != m_generation) {
+            m_index.clear();
+
+            for (const auto &arg : m_args) {
+                details::indexArgument(m_index, arg.get());
+            }
+
+            m_indexGeneration = m_generation;
+        }
+
+        return m_index;
+    }
+
+    //! \return Index of the names of all arguments in all scopes.
+    const details::NameIndex &treeIndex() const
+    {
+        if (m_treeIndexGeneration != m_generation) {
+            m_treeIndex.clear();
+
+            for (const auto &arg : m_args) {
+                details::indexTree(m_treeIndex, arg.get());
+            }
+
+            m_treeIndexGeneration = m_generation;
+        }
+
+        return m_treeIndex;
+    }
+
+    /*!
+        \return Tag of the word, i.e. of the part before "=" if
+            \a splitted is true.
+
+        Word is checked against names of all scopes, so the tag
+        tells what the word can be at all, not what it is in the
+        current scope.
+    */
+    details::TokenTag classify(const details::StringView &word,
+                               bool splitted) const
+    {
+        const auto &names = treeIndex();
+
+        if (word.length() >= 2 && word[0] == SL('-') && word[1] == SL('-')) {
+            if (word.length() == 2 && !splitted) {
+                return details::TokenTag::Separator;
+            }
+
+            return (names.find(word) ? details::TokenTag::LongOption : details::TokenTag::Value);
+        } else if (!word.empty() && word[0] == SL('-')) {
+            if (word.length() < 2) {
+                return details::TokenTag::Value;
+            }
+
+            for (std::size_t i = 1, length = word.length(); i < length; ++i) {
+                if (!names.findFlag(word[i])) {
+                    return details::TokenTag::Value;
+                }
+            }
+
+            return details::TokenTag::FlagBlock;
+        } else {
+            return (names.find(word) ? details::TokenTag::Command : details::TokenTag::Value);
+        }
+    }
+
+    //! Build indexes of the commands, ids and environment bindings of the arguments in the given subtree.
+    void buildIndexes(ArgIface *arg,
+                      //! Command the subtree belongs to, nullptr for the top level.
+                      Command *cmd)
+    {
+        arg->m_id = m_argsCount++;
+
+        switch (arg->type()) {
+        case ArgType::Command: {
+            const auto &idx = static_cast<Command *>(arg)->index();
+
+            if (m_opt & AllowAbbreviations) {
+                idx.trie();
+            }
+        }
+            // Fall through - to children.
+
+        case ArgType::OnlyOneGroup:
+        case ArgType::AllOfGroup:
+        case ArgType::AtLeastOneGroup: {
+            for (const auto &ch : details::asConst(static_cast<GroupIface *>(arg)->children())) {
+                buildIndexes(ch.get(), arg->type() == ArgType::Command ? static_cast<Command *>(arg) : cmd);
+            }
+        } break;
+
+        default: {
+            if (!arg->envVar().empty()) {
+                m_envBindings.add(arg, cmd, arg->envVar());
+            }
+        } break;
+        }
+    }
+
+    //! Update index with just added top level argument.
+    void argumentAdded(ArgIface *arg)
+    {
+        const bool isIndexActual = (m_indexGeneration == m_generation);
+
+        ++m_generation;
+
+        if (isIndexActual) {
+            details::indexArgument(m_index, arg);
+
+            m_indexGeneration = m_generation;
+        }
+    }
+
+    //! Tree of arguments was changed.
+    void treeChanged()
+    {
+        ++m_generation;
+    }
+
+    //! Parse context, words are read from the stream if it's not nullptr.
+    void parseContext(details::NulStream *stream = nullptr);
+    //! Parse context into the result, values are passed to the handler if it's not nullptr.
+    void parseContext(Context &context,
+                      ParseResult &result,
+                      ParseHandlerIface *handler = nullptr) const;
+    /*!
+        Parse context with the given state. \a sink handles found
+        arguments, errors and positional arguments. Context is fed
+        with the words of the stream if it's not nullptr.
+    */
+    template<typename Sink>
+    void parseContext(Context &context,
+                      details::ParseState &state,
+                      Sink &sink,
+                      details::NulStream *stream = nullptr) const;
+    //! Feed context with the next words of the stream.
+    template<typename Sink>
+    void feedContext(Context &context,
+                     details::NulStream &stream,
+                     details::ParseState &state,
+                     Sink &sink) const;
+    //! Expand response files of the context, \return false on error.
+    template<typename Sink>
+    bool expandResponseFiles(Context &context,
+                             details::ParseState &state,
+                             Sink &sink) const;
+    //! Apply environment variables to the arguments not defined in the command line.
+    template<typename Sink>
+    void applyEnvironment(details::ParseState &state,
+                          Sink &sink) const;
+    //! Apply config file to the arguments not defined in the command line and environment.
+    template<typename Sink>
+    void applyConfigFile(details::ParseState &state,
+                         Sink &sink) const;
+    //! Apply values not from the command line to the argument.
+    template<typename Sink>
+    void applyValues(ArgIface *arg,
+                     ContextView values,
+                     details::ParseState &state,
+                     Sink &sink) const;
+    //! \return Argument for the key of the config file or nullptr.
+    ArgIface *findConfigKey(const details::StringView &key) const;
+    //! Classify words of the context.
+    void classifyContext(Context &context) const;
+    //! \return Tag of the word of the context, see Context::classify().
+    details::TokenTag classifyWord(const details::StringView &word,
+                                   String::size_type splitOffset) const
+    {
+        return (splitOffset == String::npos ? classify(word, false) : classify(word.substr(0, splitOffset), true));
+    }
+    //! Parse next word of the context, i.e. one step of parseContext().
+    template<typename Sink>
+    void parseWord(Context &context,
+                   details::ParseState &state,
+                   Sink &sink) const;
+
+    //! Record occurrence of the argument and process it with the sink.
+    template<typename Sink>
+    static void processArgument(ArgIface *arg,
+                                Context &context,
+                                details::ParseState &state,
+                                Sink &sink)
+    {
+        state.m_occurrences.push_back(Occurrence{arg, state.m_tokenIndex});
+
+        sink.process(arg, context);
+    }
+
+    //! Check correctness of the arguments before parsing.
+    void checkCorrectnessBeforeParsing() const;
+    //! Check correctness of the arguments after parsing.
+    void checkCorrectnessAfterParsing();
+
+    /*!
+        Report error of the parsing, i.e. throw exception or keep the
+        error to return it from tryParse().
+    */
+    void reportError(ParseError error)
+    {
+        reportError(std::move(error), m_state, m_throwOnError);
+    }
+
+    /*!
+        Report error of the parsing with the given state, i.e. throw
+        exception or keep the first error in the state.
+    */
+    void reportError(ParseError error,
+                     details::ParseState &state,
+                     bool throwOnError) const
+    {
+        if (state.m_error) {
+            return;
+        }
+
+        error.m_cmdLine = this;
+        error.m_state = &state;
+        error.m_tokenIndex = state.m_tokenIndex;
+
+        if (error.m_word.empty()) {
+            error.m_word = state.m_word;
+        }
+
+        if (throwOnError) {
+            if (error.code() == ParseErrorCode::HelpPrinted) {
+                ARGS_THROW(HelpHasBeenPrintedException());
+            }
+
+            ARGS_THROW(BaseException(error.message()));
+        }
+
+        state.m_error = error;
+    }
+
+    //! \return Error of unknown or ambiguous argument.
+    ParseError unknownArgument(const details::StringView &word,
+                               const details::ParseState &state) const
+    {
+        ArgIface *found = nullptr;
+
+        return ParseError(countAbbreviations(word, found, state) > 1 ? ParseErrorCode::AmbiguousArgument
+                                                                     : ParseErrorCode::UnknownArgument);
+    }
+
+    //! \return Is the name known in the scope of the given active command or of its sub-commands.
+    static bool isInScope(const details::StringView &name,
+                          const Command *cmd,
+                          const details::ParseState &state)
+    {
+        const auto first = std::find(state.m_prevCommand.cbegin(), state.m_prevCommand.cend(), cmd);
+
+        return std::any_of(first, state.m_prevCommand.cend(), [&name](const Command *c) {
+            return (c->index().find(name) != nullptr);
+        });
+    }
+
+    /*!
+        \return Already defined command from the level of the given
+            command or nullptr.
+    */
+    const ArgIface *conflictingCommand(const ArgIface *cmd,
+                                       const details::StringView &word,
+                                       const details::ParseState &state) const
+    {
+        const auto isCmd = [cmd](const auto &arg) -> bool {
+            return (arg.get() == cmd);
+        };
+
+        for (const auto &prev : state.m_prevCommand) {
+            const auto &args = prev->children();
+
+            if (std::find_if(args.cbegin(), args.cend(), isCmd) != args.cend()
+                && !isInScope(word, state.m_currCommand, state)) {
+                return prev;
+            }
+        }
+
+        if (state.m_command && std::find_if(m_args.cbegin(), m_args.cend(), isCmd) != m_args.cend()
+            && !isInScope(word, state.m_command, state)) {
+            return state.m_command;
+        }
+
+        return nullptr;
+    }
+
+    //! Pass all positional arguments to the sink one by one.
+    template<typename Sink>
+    static void savePositionalArguments(Context &context,
+                                        details::ParseState &state,
+                                        Sink &sink,
+                                        const details::StringView &word,
+                                        bool splitted,
+                                        bool valuePrepended)
+    {
+        String tmp = word.toString();
+
+        if (splitted) {
+            tmp.append(1, '=');
 
             if (valuePrepended) {
-                tmp.append(*m_context.next());
+                tmp.append(context.next()->toString());
             }
         }
 
         if (tmp != String(2, '-')) {
-            m_positional.push_back(tmp);
+            sink.positional(std::move(tmp));
         }
 
-        while (!m_context.atEnd()) {
-            auto it = m_context.next();
+        // Words fed to the context later are positional too.
+        state.m_isPositional = true;
+
+        while (!context.atEnd()) {
+            auto it = context.next();
 
-            m_positional.push_back(*it);
+            sink.positional(it->toString());
         }
     }
 
 private:
+    friend class ParseError;
+    friend class ParseResult;
+    friend class details::ArgsSink;
+    friend class details::ResultSink;
+    friend class Repl;
+    friend void details::reportError(CmdLine *cmdLine,
+                                     ParseError error);
+
     DISABLE_COPY(CmdLine)
 
     // Context.
     Context m_context;
+    //! Arena for the arguments created with API, should outlive arguments.
+    std::unique_ptr<details::Arena> m_arena;
     //! Arguments.
     Arguments m_args;
-    //! Current top command.
-    Command *m_command;
-    //! Current command.
-    Command *m_currCommand;
-    //! Previous command.
-    std::vector<Command *> m_prevCommand;
+    //! State of the last parsing.
+    details::ParseState m_state;
     //! Option.
     CmdLineOpts m_opt;
     //! Positional arguments.
     StringList m_positional;
+    //! Receiver of positional arguments.
+    PositionalSinkIface *m_positionalSink;
+    //! Config file, shared with the parsed results.
+    std::shared_ptr<const details::ConfigFile> m_configFile;
+    //! Stream of the last parseStream(), words of the context refer to it.
+    std::unique_ptr<details::NulStream> m_stream;
+    //! Arguments bound to the environment variables, built with freeze().
+    details::EnvBindings m_envBindings;
     //! Positional string description for the help.
     String m_positionalDescription;
+    //! Generation of the tree of arguments, incremented on each change.
+    std::size_t m_generation;
+    //! Generation of the tree of arguments that was checked with freeze().
+    std::size_t m_frozenGeneration;
+    //! Generation of the tree of arguments the index was built for.
+    mutable std::size_t m_indexGeneration;
+    //! Index of the names of top level arguments.
+    mutable details::NameIndex m_index;
+    //! Generation of the tree of arguments the index of all names was built for.
+    mutable std::size_t m_treeIndexGeneration;
+    //! Index of the names of all arguments in all scopes.
+    mutable details::NameIndex m_treeIndex;
+    //! Count of the arguments in the tree, set with freeze().
+    std::size_t m_argsCount;
+    //! Should errors of the parsing be thrown?
+    bool m_throwOnError;
 }; // class CmdLine
 
 //
@@ -501,12 +1407,22 @@ inline
                    ArgPtr,
                    true>(*this,
                          *this)
-    , m_context(details::makeContext(argc,
-                                     argv))
-    , m_command(nullptr)
-    , m_currCommand(nullptr)
+    , m_arena(opt & UseArena ? new details::Arena : nullptr)
     , m_opt(opt)
+    , m_positionalSink(nullptr)
+    , m_generation(1)
+    , m_frozenGeneration(0)
+    , m_indexGeneration(0)
+    , m_treeIndexGeneration(0)
+    , m_argsCount(0)
+    , m_throwOnError(true)
 {
+    // Parsing may be done long after construction, so argv is copied by default.
+    if (opt & BorrowArguments) {
+        m_context = details::makeContext(argc, argv);
+    } else {
+        m_context = details::copyContext(argc, argv);
+    }
 }
 
 inline CmdLine &CmdLine::addArg(ArgIface *arg)
@@ -516,13 +1432,17 @@ inline CmdLine &CmdLine::addArg(ArgIface *arg)
             arg->setCmdLine(this);
 
             m_args.push_back(ArgPtr(arg, details::Deleter<ArgIface>(false)));
+
+            argumentAdded(arg);
         } else {
-            throw BaseException(String(SL("Argument \"")) + arg->name() + SL("\" already in the command line parser."));
+            ARGS_THROW(BaseException(String(SL("Argument \""))
+                                     + arg->name()
+                                     + SL("\" already in the command line parser.")));
         }
     } else {
-        throw BaseException(
+        ARGS_THROW(BaseException(
             String(SL("Attempt to add nullptr to the "
-                      "command line as argument.")));
+                      "command line as argument."))));
     }
     return *this;
 }
@@ -532,184 +1452,861 @@ inline CmdLine &CmdLine::addArg(ArgIface &arg)
     return addArg(&arg);
 }
 
-inline void CmdLine::parse()
+namespace details
 {
-    clear();
 
-    checkCorrectnessBeforeParsing();
+//
+// ArgsSink
+//
 
-    while (!m_context.atEnd()) {
-        String word = *m_context.next();
+//! Sink of the parsing that stores parsed state in the arguments.
+class ArgsSink final
+{
+public:
+    explicit ArgsSink(CmdLine &cmdLine)
+        : m_cmdLine(cmdLine)
+    {
+    }
 
-        const String::size_type eqIt = word.find('=');
+    //! \return Is the argument defined?
+    bool isDefined(const ArgIface *arg) const
+    {
+        return arg->isDefined();
+    }
 
-        bool splitted = false;
-        bool valuePrepended = false;
+    //! Process found argument.
+    void process(ArgIface *arg,
+                 Context &context)
+    {
+        arg->process(context);
+    }
 
-        if (eqIt != String::npos) {
-            splitted = true;
+    //! Set sub-command of the command.
+    void subCommand(Command *parent,
+                    Command *cmd)
+    {
+        parent->setCurrentSubCommand(cmd);
+    }
 
-            const String value = word.substr(eqIt + 1);
+    //! Handle positional argument.
+    void positional(String &&word)
+    {
+        if (m_cmdLine.m_positionalSink) {
+            m_cmdLine.m_positionalSink->positional(std::move(word));
+        } else {
+            m_cmdLine.m_positional.push_back(std::move(word));
+        }
+    }
 
-            if (!value.empty()) {
-                valuePrepended = true;
-                m_context.prepend(value);
-            }
+    //! Report error.
+    void error(ParseError error)
+    {
+        m_cmdLine.reportError(std::move(error));
+    }
 
-            word = word.substr(0, eqIt);
-        }
+    //! Check correctness of the arguments after parsing.
+    void checkCorrectnessAfterParsing()
+    {
+        m_cmdLine.checkCorrectnessAfterParsing();
+    }
 
-        if (details::isArgument(word)) {
-            auto *arg = findArgument(word);
+private:
+    //! Parser.
+    CmdLine &m_cmdLine;
+}; // class ArgsSink
 
-            if (arg) {
-                arg->process(m_context);
-            } else if (m_opt & HandlePositionalArguments) {
-                savePositionalArguments(word, splitted, valuePrepended);
-            } else {
-                printInfoAboutUnknownArgument(word);
-            }
-        } else if (details::isFlag(word)) {
-            std::vector<ArgIface *> tmpArgs;
-            bool failed = false;
+//
+// ResultSink
+//
 
-            for (String::size_type i = 1, length = word.length(); i < length; ++i) {
-                const String flag = String(SL("-")) +
+//! Sink of the parsing that stores parsed state in ParseResult.
+class ResultSink final
+{
+public:
+    ResultSink(const CmdLine &cmdLine,
+               ParseResult &result,
+               //! Changes of the parsed state are recorded here if not nullptr.
+               std::vector<ParsedArgUndo> *undo = nullptr,
+               //! Values and positional arguments are passed here instead of the result if not nullptr.
+               ParseHandlerIface *handler = nullptr)
+        : m_cmdLine(cmdLine)
+        , m_result(result)
+        , m_undo(undo)
+        , m_handler(handler)
+        , m_isHelpDefined(false)
+    {
+    }
 
-#ifdef ARGS_QSTRING_BUILD
-                    String(word[i]);
-#else
-                    String(1, word[i]);
-#endif
+    //! \return Argument for the given name in the current scope.
+    ArgIface *findArgument(const details::StringView &name) const
+    {
+        return m_cmdLine.lookup(name, m_result.m_state);
+    }
 
-                auto *arg = findArgument(flag);
+    //! \return Argument for the given flag without leading dash in the current scope.
+    ArgIface *findFlag(Char flag) const
+    {
+        return m_cmdLine.findFlag(flag, m_result.m_state);
+    }
 
-                if (!arg) {
-                    failed = true;
+    //! \return Is the argument defined?
+    bool isDefined(const ArgIface *arg) const
+    {
+        return m_result.parsed(*arg)->m_isDefined;
+    }
 
-                    if (!(m_opt & HandlePositionalArguments)) {
-                        throw BaseException(String(SL("Unknown argument \"")) + flag + SL("\"."));
-                    } else {
-                        break;
-                    }
-                } else {
-                    tmpArgs.push_back(arg);
-                }
+    //! Process found argument.
+    void process(ArgIface *arg,
+                 Context &context)
+    {
+        ParsedArg &parsed = *m_result.parsed(*arg);
 
-                if (i < length - 1 && arg->isWithValue()) {
-                    failed = true;
+        remember(parsed);
 
-                    if (!(m_opt & HandlePositionalArguments)) {
-                        throw BaseException(String(SL("Only last argument in "
-                                                      "flags combo can be with value. Flags combo is \""))
-                                            + word
-                                            + SL("\"."));
-                    } else {
-                        break;
-                    }
-                } else {
-                    arg->process(m_context);
+        Values values(*this, arg, parsed);
+
+        switch (arg->type()) {
+        case ArgType::Command: {
+            parsed.m_isDefined = true;
+
+            if (m_handler) {
+                m_handler->command(*static_cast<Command *>(arg));
+            }
+
+            switch (static_cast<Command *>(arg)->m_opt) {
+            case ValueOptions::ManyValues: {
+                if (!details::eatValues(context, values, this)) {
+                    error(ParseError(ParseErrorCode::ValueRequired, arg));
+                }
+            } break;
+
+            case ValueOptions::OneValue: {
+                eatOneValue(context, parsed, arg);
+            } break;
+
+            default:
+                break;
+            }
+        } break;
+
+        case ArgType::MultiArg: {
+            if (m_handler) {
+                m_handler->argument(*arg);
+            }
+
+            if (arg->isWithValue()) {
+                parsed.m_isDefined = details::eatValues(context, values, this);
+
+                if (!parsed.m_isDefined) {
+                    error(ParseError(ParseErrorCode::ValueRequired, arg));
                 }
+            } else {
+                parsed.m_isDefined = true;
+
+                ++parsed.m_count;
             }
+        } break;
+
+        default: {
+            if (dynamic_cast<Help *>(arg)) {
+                parsed.m_isDefined = true;
+
+                m_isHelpDefined = true;
+
+                if (m_handler) {
+                    m_handler->argument(*arg);
+                }
+
+                while (!context.atEnd()) {
+                    values.push_back(context.next()->toString());
+                }
+            } else if (parsed.m_isDefined) {
+                error(ParseError(ParseErrorCode::AlreadyDefined, arg));
+            } else {
+                if (m_handler) {
+                    m_handler->argument(*arg);
+                }
 
-            if (failed && (m_opt & HandlePositionalArguments)) {
-                for (auto *a : tmpArgs) {
-                    a->clear();
+                if (arg->isWithValue()) {
+                    eatOneValue(context, parsed, arg);
                 }
 
-                savePositionalArguments(word, splitted, valuePrepended);
+                parsed.m_isDefined = true;
+
+                ++parsed.m_count;
             }
+        } break;
+        }
+    }
+
+    //! Set sub-command of the command.
+    void subCommand(Command *parent,
+                    Command *cmd)
+    {
+        ParsedArg &parsed = *m_result.parsed(*parent);
+
+        remember(parsed);
+
+        parsed.m_subCommand = cmd;
+    }
+
+    //! Handle positional argument.
+    void positional(String &&word)
+    {
+        if (m_handler) {
+            m_handler->positional(word);
+        } else {
+            m_result.m_positional.push_back(std::move(word));
+        }
+    }
+
+    //! Report error.
+    void error(ParseError error)
+    {
+        m_cmdLine.reportError(std::move(error), m_result.m_state, false);
+    }
+
+    //! Check correctness of the arguments after parsing, not needed if help is defined.
+    void checkCorrectnessAfterParsing()
+    {
+        if (m_isHelpDefined) {
+            return;
+        }
+
+        for (const auto &arg : m_cmdLine.arguments()) {
+            checkCorrectnessAfterParsing(*arg);
+        }
+
+        if (m_cmdLine.parserOptions() & CmdLine::CommandIsRequired && !m_result.command()) {
+            error(ParseError(ParseErrorCode::CommandNotSpecified));
+        }
+    }
+
+private:
+    //! Values of the argument, i.e. container for eatValues().
+    class Values final
+    {
+    public:
+        Values(ResultSink &sink,
+               const ArgIface *arg,
+               ParsedArg &parsed)
+            : m_sink(sink)
+            , m_arg(arg)
+            , m_parsed(parsed)
+        {
+        }
+
+        void push_back(String &&value)
+        {
+            m_sink.addValue(m_arg, m_parsed, std::move(value));
+        }
+
+    private:
+        //! Sink.
+        ResultSink &m_sink;
+        //! Argument.
+        const ArgIface *m_arg;
+        //! Parsed state of the argument.
+        ParsedArg &m_parsed;
+    }; // class Values
+
+    //! Remember parsed state before the change.
+    void remember(ParsedArg &parsed)
+    {
+        if (m_undo) {
+            m_undo->push_back(ParsedArgUndo{&parsed,
+                                            parsed.m_isDefined,
+                                            parsed.m_count,
+                                            static_cast<std::size_t>(parsed.m_values.size()),
+                                            parsed.m_subCommand});
         }
-        // Command?
-        else {
-            auto *tmp = findArgument(word);
+    }
+
+    //! Eat one value of the argument.
+    void eatOneValue(Context &context,
+                     ParsedArg &parsed,
+                     ArgIface *arg)
+    {
+        if (!context.atEnd() && !details::isKnownWord(context, 0, *context.begin(), this)) {
+            addValue(arg, parsed, context.next()->toString());
+        } else {
+            error(ParseError(ParseErrorCode::ValueRequired, arg));
+        }
+    }
 
-            auto check = [this, &tmp, &word]() {
-                const auto &args = m_args;
+    /*!
+        Check the value of the argument, i.e. of typed argument, and
+        keep it or pass it to the handler. Values after the error are
+        not passed to the handler.
+    */
+    void addValue(const ArgIface *arg,
+                  ParsedArg &parsed,
+                  String &&value)
+    {
+        const auto *a = dynamic_cast<const Arg *>(arg);
 
-                const auto it = std::find_if(args.cbegin(), args.cend(), [&tmp](const auto &arg) -> bool {
-                    return (arg.get() == tmp);
-                });
+        if (a && !a->isValueValid(value)) {
+            error(ParseError::invalidValue(arg, value));
+        }
 
-                if (m_command && it != args.cend() && !m_command->findChild(word)) {
-                    throw BaseException(String(SL("Only one command from one level can be specified. "
-                                                  "But you defined \""))
-                                        + word
-                                        + SL("\" and \"")
-                                        + m_command->name()
-                                        + SL("\"."));
+        if (!m_handler) {
+            parsed.m_values.push_back(std::move(value));
+        } else if (!m_result.m_state.m_error) {
+            m_handler->value(*arg, value);
+        }
+    }
+
+    //! Check correctness of the argument after parsing the same way the argument does.
+    void checkCorrectnessAfterParsing(const ArgIface &arg)
+    {
+        switch (arg.type()) {
+        case ArgType::Command: {
+            if (m_result.isDefined(arg)) {
+                checkChildren(arg);
+
+                if (static_cast<const Command &>(arg).m_isSubCommandRequired
+                    && !m_result.subCommand(static_cast<const Command &>(arg))) {
+                    error(ParseError(ParseErrorCode::RequiredSubCommandNotDefined, &arg));
                 }
-            };
-
-            if (tmp && tmp->type() == ArgType::Command) {
-                bool stopProcessing = false;
-
-                try {
-                    if (!m_prevCommand.empty()) {
-                        for (const auto &prev : m_prevCommand) {
-                            const auto &args = prev->children();
-
-                            const auto it =
-                                std::find_if(args.cbegin(), args.cend(), [&tmp](const auto &arg) -> bool {
-                                    return (arg.get() == tmp);
-                                });
-
-                            if (it != args.cend() && !m_currCommand->findChild(word)) {
-                                throw BaseException(String(SL("Only one command from one level can be specified. "
-                                                              "But you defined \""))
-                                                    + word
-                                                    + SL("\" and \"")
-                                                    + prev->name()
-                                                    + SL("\"."));
-                            }
+            }
+        } break;
+
+        case ArgType::OnlyOneGroup:
+        case ArgType::AllOfGroup:
+        case ArgType::AtLeastOneGroup: {
+            checkChildren(arg);
+
+            if (arg.isRequired() && !m_result.isDefined(arg)) {
+                error(ParseError(ParseErrorCode::RequiredArgumentNotDefined, &arg));
+            }
+
+            const auto &children = static_cast<const GroupIface &>(arg).children();
+
+            if (arg.type() == ArgType::OnlyOneGroup) {
+                const ArgIface *defined = nullptr;
+
+                for (const auto &ch : children) {
+                    if (m_result.isDefined(*ch)) {
+                        if (defined) {
+                            error(ParseError(ParseErrorCode::OnlyOneGroupViolated, ch.get(), defined, &arg));
+
+                            break;
                         }
 
-                        check();
-                    } else {
-                        check();
+                        defined = ch.get();
                     }
-                } catch (const BaseException &) {
-                    if (m_opt & HandlePositionalArguments) {
-                        savePositionalArguments(word, splitted, valuePrepended);
+                }
+            } else if (arg.type() == ArgType::AllOfGroup) {
+                const auto isDefined = [this](const auto &ch) {
+                    return m_result.isDefined(*ch);
+                };
+
+                if (std::any_of(children.cbegin(), children.cend(), isDefined)
+                    && !std::all_of(children.cbegin(), children.cend(), isDefined)) {
+                    error(ParseError(ParseErrorCode::AllOfGroupViolated, nullptr, nullptr, &arg));
+                }
+            }
+        } break;
 
-                        stopProcessing = true;
-                    } else {
-                        throw;
-                    }
+        default: {
+            if (arg.isRequired() && !m_result.isDefined(arg)) {
+                error(ParseError(ParseErrorCode::RequiredArgumentNotDefined, &arg));
+            }
+        } break;
+        }
+    }
+
+    //! Check correctness of the children of the group after parsing.
+    void checkChildren(const ArgIface &arg)
+    {
+        for (const auto &ch : static_cast<const GroupIface &>(arg).children()) {
+            checkCorrectnessAfterParsing(*ch);
+        }
+    }
+
+private:
+    //! Parser.
+    const CmdLine &m_cmdLine;
+    //! Result.
+    ParseResult &m_result;
+    //! Changes of the parsed state.
+    std::vector<ParsedArgUndo> *m_undo;
+    //! Handler of values and positional arguments.
+    ParseHandlerIface *m_handler;
+    //! Is help defined?
+    bool m_isHelpDefined;
+}; // class ResultSink
+
+} /* namespace details */
+
+inline void CmdLine::parse()
+{
+    m_throwOnError = true;
+
+    parseContext();
+}
+
+inline ParseError CmdLine::tryParse()
+{
+    m_throwOnError = false;
+
+    parseContext();
+
+    return m_state.m_error;
+}
+
+inline void CmdLine::parseStream(int fd)
+{
+    m_throwOnError = true;
+
+    m_context = ContextView();
+    m_stream.reset(new details::NulStream(fd));
+
+    parseContext(m_stream.get());
+}
+
+inline ParseError CmdLine::tryParseStream(int fd)
+{
+    m_throwOnError = false;
+
+    m_context = ContextView();
+    m_stream.reset(new details::NulStream(fd));
+
+    parseContext(m_stream.get());
+
+    return m_state.m_error;
+}
+
+inline void CmdLine::parseContext(details::NulStream *stream)
+{
+    clear();
+
+    freeze();
+
+    details::ArgsSink sink(*this);
+
+    parseContext(m_context, m_state, sink, stream);
+}
+
+inline void CmdLine::parseContext(Context &context,
+                                  ParseResult &result,
+                                  ParseHandlerIface *handler) const
+{
+    if (!isFrozen()) {
+        ARGS_THROW(BaseException(
+            String(SL("Command line parser should be frozen "
+                      "before parsing to the result."))));
+    }
+
+    result.m_cmdLine = this;
+    result.m_args.resize(m_argsCount);
+
+    details::ResultSink sink(*this, result, nullptr, handler);
+
+    parseContext(context, result.m_state, sink);
+
+    result.m_responseFiles = context.responseFiles();
+    result.m_configFile = m_configFile;
+}
+
+template<typename Sink>
+void CmdLine::parseContext(Context &context,
+                           details::ParseState &state,
+                           Sink &sink,
+                           details::NulStream *stream) const
+{
+    if (!stream && m_opt & ExpandResponseFiles && !expandResponseFiles(context, state, sink)) {
+        return;
+    }
+
+    classifyContext(context);
+
+    while (!state.m_error) {
+        if (stream && !stream->atEnd() && context.remaining() < details::NulStream::c_lookAhead) {
+            feedContext(context, *stream, state, sink);
+
+            if (state.m_error) {
+                break;
+            }
+        }
+
+        if (context.atEnd()) {
+            break;
+        }
+
+        if (state.m_isPositional) {
+            state.m_tokenIndex = context.pos();
+
+            sink.positional(context.next()->toString());
+        } else {
+            parseWord(context, state, sink);
+        }
+    }
+
+    state.m_tokenIndex = ParseError::c_noToken;
+    state.m_word = details::StringView();
+
+    if (!state.m_error && !m_envBindings.empty()) {
+        applyEnvironment(state, sink);
+    }
+
+    if (!state.m_error && m_configFile) {
+        applyConfigFile(state, sink);
+    }
+
+    if (!state.m_error) {
+        sink.checkCorrectnessAfterParsing();
+    }
+}
+
+template<typename Sink>
+void CmdLine::applyEnvironment(details::ParseState &state,
+                               Sink &sink) const
+{
+    std::vector<details::EnvBindings::Value> values;
+
+    m_envBindings.resolve(values);
+
+    const auto &bindings = m_envBindings.bindings();
+
+    for (std::size_t i = 0; i < bindings.size() && !state.m_error; ++i) {
+        const auto &binding = bindings[i];
+
+        if (!values[i].m_isSet || sink.isDefined(binding.m_arg)) {
+            continue;
+        }
+
+        // Arguments of the commands are applied only if the command is active.
+        if (binding.m_command
+            && std::find(state.m_prevCommand.cbegin(), state.m_prevCommand.cend(), binding.m_command)
+                == state.m_prevCommand.cend()) {
+            continue;
+        }
+
+        applyValues(binding.m_arg, ContextView(1, values[i].m_value), state, sink);
+    }
+}
+
+template<typename Sink>
+void CmdLine::applyConfigFile(details::ParseState &state,
+                              Sink &sink) const
+{
+    static const std::size_t c_noEntry = static_cast<std::size_t>(-1);
+
+    const auto &entries = m_configFile->entries();
+
+    // Entries of one argument are linked in the order of the lines.
+    std::vector<ArgIface *> args(entries.size(), nullptr);
+    std::vector<std::size_t> nextEntry(entries.size(), c_noEntry);
+    std::vector<std::size_t> lastEntry(m_argsCount, c_noEntry);
+
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        args[i] = findConfigKey(entries[i].m_key);
+
+        if (!args[i]) {
+            sink.error(ParseError::unknownConfigKey(entries[i].m_key.toString()));
+
+            return;
+        }
+
+        std::size_t &last = lastEntry[args[i]->m_id];
+
+        if (last != c_noEntry) {
+            nextEntry[last] = i;
+        }
+
+        last = i;
+    }
+
+    for (std::size_t i = 0; i < entries.size() && !state.m_error; ++i) {
+        ArgIface *arg = args[i];
+
+        // Argument is applied at its first line only.
+        if (lastEntry[arg->m_id] == c_noEntry || sink.isDefined(arg)) {
+            lastEntry[arg->m_id] = c_noEntry;
+
+            continue;
+        }
+
+        const bool isMulti = (arg->type() == ArgType::MultiArg);
+        const std::size_t first = (isMulti ? i : lastEntry[arg->m_id]);
+
+        lastEntry[arg->m_id] = c_noEntry;
+
+        state.m_word = entries[first].m_key;
+
+        // Value of the line without "=" is empty, i.e. defined flag.
+        ContextView values;
+
+        for (std::size_t j = first; j != c_noEntry; j = nextEntry[j]) {
+            if (entries[j].m_hasValue || !arg->isWithValue()) {
+                values.push_back(entries[j].m_value);
+            }
+        }
+
+        applyValues(arg, std::move(values), state, sink);
+    }
+
+    state.m_word = details::StringView();
+}
+
+template<typename Sink>
+void CmdLine::applyValues(ArgIface *arg,
+                          ContextView values,
+                          details::ParseState &state,
+                          Sink &sink) const
+{
+    if (arg->isWithValue()) {
+        // Values are never taken for names.
+        Context context(std::move(values));
+
+        context.classify([](const details::StringView &, String::size_type) {
+            return details::TokenTag::Value;
+        });
+
+        processArgument(arg, context, state, sink);
+    } else {
+        Context context;
+
+        for (const auto &value : details::asConst(values)) {
+            bool isOn = true;
+
+            if (!value.empty() && !details::toBool(value, isOn)) {
+                sink.error(ParseError::invalidValue(arg, value.toString()));
+            } else if (isOn) {
+                processArgument(arg, context, state, sink);
+            }
+
+            if (state.m_error) {
+                return;
+            }
+        }
+    }
+}
+
+inline ArgIface *CmdLine::findConfigKey(const details::StringView &key) const
+{
+    ArgIface *arg = nullptr;
+
+    if (key[0] == Char(SL('-'))) {
+        arg = index().find(key);
+    } else {
+        arg = index().find((key.size() == 1 ? String(SL("-")) : String(SL("--"))) + key.toString());
+    }
+
+    if (arg && (arg->type() == ArgType::Arg || arg->type() == ArgType::MultiArg) && !dynamic_cast<Help *>(arg)) {
+        return arg;
+    }
+
+    return nullptr;
+}
+
+template<typename Sink>
+bool CmdLine::expandResponseFiles(Context &context,
+                                  details::ParseState &state,
+                                  Sink &sink) const
+{
+    std::size_t failed = 0;
+    String fileName;
+
+    if (context.expandResponseFiles(failed, fileName)) {
+        return true;
+    }
+
+    state.m_tokenIndex = failed;
+    state.m_word = *std::next(context.begin(), static_cast<std::ptrdiff_t>(failed));
+
+    sink.error(ParseError::recursiveResponseFile(std::move(fileName)));
+
+    state.m_tokenIndex = ParseError::c_noToken;
+    state.m_word = details::StringView();
+
+    return false;
+}
+
+inline void CmdLine::classifyContext(Context &context) const
+{
+    context.classify([this](const details::StringView &word, String::size_type splitOffset) {
+        return classifyWord(word, splitOffset);
+    });
+}
+
+template<typename Sink>
+void CmdLine::feedContext(Context &context,
+                          details::NulStream &stream,
+                          details::ParseState &state,
+                          Sink &sink) const
+{
+    // Taken words are dropped, so chunks with them aren't needed.
+    state.m_word = details::StringView();
+
+    stream.release(context.pos());
+
+    ContextView words;
+
+    while (words.size() < details::NulStream::c_lookAhead && stream.read(words)) {
+    }
+
+    if (stream.isFailed()) {
+        state.m_tokenIndex = ParseError::c_noToken;
+
+        sink.error(ParseError(String(SL("Unable to read the stream of the arguments."))));
+
+        return;
+    }
+
+    context.feed(words, [this](const details::StringView &word, String::size_type splitOffset) {
+        return classifyWord(word, splitOffset);
+    });
+}
+
+template<typename Sink>
+void CmdLine::parseWord(Context &context,
+                        details::ParseState &state,
+                        Sink &sink) const
+{
+    const details::TokenTag tag = context.tag();
+    const String::size_type eqIt = context.splitOffset(*context.begin());
+
+    state.m_tokenIndex = context.pos();
+
+    const details::StringView token = *context.next();
+
+    const bool splitted = (eqIt != String::npos);
+    bool valuePrepended = false;
+
+    if (splitted && static_cast<std::size_t>(eqIt) + 1 < token.length()) {
+        valuePrepended = true;
+        context.putBackValue(eqIt);
+    }
+
+    state.m_word = (splitted ? token.substr(0, eqIt) : token);
+
+    details::StringView word = state.m_word;
+
+    if (details::isArgument(word)) {
+        auto *arg = (tag == details::TokenTag::Value ? nullptr : lookup(word, state));
+
+        if (!arg) {
+            arg = findAbbreviation(word, state);
+        }
+
+        if (arg) {
+            processArgument(arg, context, state, sink);
+        } else if (m_opt & HandlePositionalArguments) {
+            savePositionalArguments(context, state, sink, word, splitted, valuePrepended);
+        } else {
+            sink.error(unknownArgument(word, state));
+        }
+    } else if (details::isFlag(word)) {
+        const String::size_type length = word.length();
+        bool failed = false;
+
+        // Check the whole block before processing, so nothing is
+        // changed if the block appears to be a positional argument.
+        for (String::size_type i = 1; i < length && !failed; ++i) {
+            auto *arg = findFlag(word[i], state);
+
+            if (!arg) {
+                failed = true;
+
+                if (!(m_opt & HandlePositionalArguments)) {
+                    ParseError error(ParseErrorCode::UnknownFlag);
+                    error.m_word = state.m_word.substr(static_cast<std::size_t>(i), 1);
+
+                    sink.error(error);
                 }
+            } else if (i < length - 1 && arg->isWithValue()) {
+                failed = true;
 
-                if (stopProcessing) {
-                    continue;
+                if (!(m_opt & HandlePositionalArguments)) {
+                    sink.error(ParseError(ParseErrorCode::FlagsComboWithValue, arg));
                 }
+            }
+        }
 
-                if (!m_command) {
-                    m_command = static_cast<Command *>(tmp);
+        if (!failed) {
+            for (String::size_type i = 1; i < length && !state.m_error; ++i) {
+                processArgument(findFlag(word[i], state), context, state, sink);
+            }
+        } else if (m_opt & HandlePositionalArguments) {
+            savePositionalArguments(context, state, sink, word, splitted, valuePrepended);
+        }
+    }
+    // Command?
+    else {
+        auto *tmp = (tag == details::TokenTag::Value ? nullptr : lookup(word, state));
 
-                    m_currCommand = m_command;
+        // Owns the full name of the abbreviated command.
+        String name;
 
-                    m_prevCommand.push_back(m_command);
+        if (!tmp) {
+            tmp = findAbbreviation(word, state);
 
-                    m_command->process(m_context);
-                } else {
-                    auto *cmd = static_cast<Command *>(tmp);
+            if (tmp) {
+                name = tmp->name();
+                word = name;
+            }
+        }
 
-                    m_currCommand->setCurrentSubCommand(cmd);
+        if (tmp && tmp->type() == ArgType::Command) {
+            const ArgIface *defined = conflictingCommand(tmp, word, state);
 
-                    m_currCommand = cmd;
+            if (defined) {
+                if (m_opt & HandlePositionalArguments) {
+                    savePositionalArguments(context, state, sink, word, splitted, valuePrepended);
+                } else {
+                    sink.error(ParseError(ParseErrorCode::OnlyOneCommand, tmp, defined));
+                }
 
-                    m_prevCommand.push_back(m_currCommand);
+                return;
+            }
 
-                    m_currCommand->process(m_context);
-                }
-            } else if (m_opt & HandlePositionalArguments) {
-                savePositionalArguments(word, splitted, valuePrepended);
+            auto *cmd = static_cast<Command *>(tmp);
+
+            if (!state.m_command) {
+                state.m_command = cmd;
             } else {
-                printInfoAboutUnknownArgument(word);
+                sink.subCommand(state.m_currCommand, cmd);
             }
+
+            state.m_currCommand = cmd;
+
+            state.m_prevCommand.push_back(cmd);
+
+            processArgument(cmd, context, state, sink);
+        } else if (m_opt & HandlePositionalArguments) {
+            savePositionalArguments(context, state, sink, word, splitted, valuePrepended);
+        } else {
+            sink.error(unknownArgument(word, state));
         }
     }
+}
+
+inline void CmdLine::freeze()
+{
+    if (isFrozen()) {
+        return;
+    }
+
+    checkCorrectnessBeforeParsing();
+
+    const auto &idx = index();
+
+    if (m_opt & AllowAbbreviations) {
+        idx.trie();
+    }
+
+    treeIndex();
+
+    m_argsCount = 0;
+    m_envBindings.clear();
+
+    for (const auto &arg : m_args) {
+        buildIndexes(arg.get(), nullptr);
+    }
 
-    checkCorrectnessAfterParsing();
+    m_frozenGeneration = m_generation;
 }
 
 inline const CmdLine::Arguments &CmdLine::arguments() const
@@ -737,17 +2334,324 @@ inline void CmdLine::checkCorrectnessBeforeParsing() const
     });
 }
 
-inline void CmdLine::checkCorrectnessAfterParsing() const
+inline void CmdLine::checkCorrectnessAfterParsing()
 {
     std::for_each(m_args.begin(), m_args.end(), [](const auto &arg) {
         arg->checkCorrectnessAfterParsing();
     });
 
-    if (m_opt & CommandIsRequired && !m_command) {
-        throw BaseException(SL("Not specified command."));
+    if (m_opt & CommandIsRequired && !m_state.m_command) {
+        reportError(ParseError(ParseErrorCode::CommandNotSpecified));
     }
 }
 
+//
+// ArgIface
+//
+
+inline void ArgIface::notifyTreeChanged()
+{
+    if (m_cmdLine) {
+        m_cmdLine->treeChanged();
+    }
+}
+
+namespace details
+{
+
+//
+// arenaOf
+//
+
+inline Arena *arenaOf(const ArgIface &arg)
+{
+    return (arg.cmdLine() ? arg.cmdLine()->arena() : nullptr);
+}
+
+inline Arena *arenaOf(const CmdLine &cmdLine)
+{
+    return cmdLine.arena();
+}
+
+//
+// reportError
+//
+
+inline void reportError(CmdLine *cmdLine,
+                        ParseError error)
+{
+    if (cmdLine) {
+        cmdLine->reportError(std::move(error));
+    } else {
+        ARGS_THROW(BaseException(error.message()));
+    }
+}
+
+} /* namespace details */
+
+//
+// ParseError
+//
+
+inline String ParseError::argumentName() const
+{
+    return (m_arg ? m_arg->name() : m_staticArg->name());
+}
+
+inline String ParseError::message() const
+{
+    switch (m_code) {
+    case ParseErrorCode::NoError:
+        return String();
+
+    case ParseErrorCode::UnknownArgument: {
+        const String word = m_word.toString();
+
+        StringList correctNames;
+
+        if (m_cmdLine && m_state && m_cmdLine->isMisspelledName(word, correctNames, *m_state)) {
+            return String(SL("Unknown argument \""))
+                + word
+                + SL("\".\n\nProbably you mean \"")
+                + details::formatCorrectNamesString(correctNames)
+                + SL("\".");
+        }
+
+        return String(SL("Unknown argument \"")) + word + SL("\".");
+    }
+
+    case ParseErrorCode::AmbiguousArgument: {
+        const String word = m_word.toString();
+
+        StringList candidates;
+
+        if (m_cmdLine && m_state) {
+            m_cmdLine->collectAbbreviations(word, candidates, *m_state);
+        }
+
+        return String(SL("Ambiguous argument \""))
+            + word
+            + SL("\".\n\nProbably you mean \"")
+            + details::formatCorrectNamesString(candidates)
+            + SL("\".");
+    }
+
+    case ParseErrorCode::UnknownFlag:
+        return String(SL("Unknown argument \"-")) + m_word.toString() + SL("\".");
+
+    case ParseErrorCode::FlagsComboWithValue:
+        return String(SL("Only last argument in flags combo can be with value. Flags combo is \""))
+            + m_word.toString()
+            + SL("\".");
+
+    case ParseErrorCode::ValueRequired:
+        return String(m_arg && m_arg->type() == ArgType::Command ? SL("Command \"") : SL("Argument \""))
+            + argumentName()
+            + SL("\" requires value that wasn't presented.");
+
+    case ParseErrorCode::InvalidValue:
+        return String(SL("Invalid value \"")) + m_message + SL("\" of argument \"") + m_arg->name() + SL("\".");
+
+    case ParseErrorCode::RecursiveResponseFile:
+        return String(SL("Recursive inclusion of response file \"")) + m_message + SL("\".");
+
+    case ParseErrorCode::UnknownConfigKey:
+        return String(SL("Unknown key \"")) + m_message + SL("\" in config file \"")
+            + (m_cmdLine ? m_cmdLine->configFile() : String()) + SL("\".");
+
+    case ParseErrorCode::AlreadyDefined:
+        return String(SL("Argument \"")) + argumentName() + SL("\" already defined.");
+
+    case ParseErrorCode::OnlyOneCommand:
+        return String(SL("Only one command from one level can be specified. But you defined \""))
+            + m_arg->name()
+            + SL("\" and \"")
+            + m_otherArg->name()
+            + SL("\".");
+
+    case ParseErrorCode::CommandNotSpecified:
+        return SL("Not specified command.");
+
+    case ParseErrorCode::RequiredArgumentNotDefined: {
+        if (!m_arg || m_arg->type() == ArgType::Arg || m_arg->type() == ArgType::MultiArg) {
+            return String(SL("Undefined required argument \"")) + argumentName() + SL("\".");
+        }
+
+        return String(SL("Not defined required argument \"")) + m_arg->name() + SL("\"");
+    }
+
+    case ParseErrorCode::RequiredSubCommandNotDefined:
+        return String(SL("Wasn't defined required sub-command of command \"")) + m_arg->name() + SL("\".");
+
+    case ParseErrorCode::OnlyOneGroupViolated:
+        return String(SL("Only one argument can be defined in OnlyOne group \""))
+            + m_group->name()
+            + SL("\". Whereas defined \"")
+            + m_otherArg->name()
+            + SL("\" and \"")
+            + m_arg->name()
+            + SL("\".");
+
+    case ParseErrorCode::AllOfGroupViolated:
+        return String(SL("All arguments in AllOf group \"")) + m_group->name() + SL("\" should be defined.");
+
+    case ParseErrorCode::HelpPrinted:
+        return SL("Help has been printed.");
+
+    default:
+        return m_message;
+    }
+}
+
+//
+// ParseResult
+//
+
+inline ParseError ParseResult::error() const
+{
+    ParseError error = m_state.m_error;
+
+    if (error) {
+        error.m_state = &m_state;
+    }
+
+    return error;
+}
+
+inline const details::ParsedArg *ParseResult::parsed(const ArgIface &arg) const
+{
+    if (m_cmdLine && arg.cmdLine() == m_cmdLine && arg.m_id < m_args.size()) {
+        return &m_args[arg.m_id];
+    }
+
+    return nullptr;
+}
+
+inline details::ParsedArg *ParseResult::parsed(const ArgIface &arg)
+{
+    if (m_cmdLine && arg.cmdLine() == m_cmdLine && arg.m_id < m_args.size()) {
+        return &m_args[arg.m_id];
+    }
+
+    return nullptr;
+}
+
+inline bool ParseResult::isDefined(const ArgIface &arg) const
+{
+    const auto isDefined = [this](const auto &ch) {
+        return this->isDefined(*ch);
+    };
+
+    switch (arg.type()) {
+    case ArgType::OnlyOneGroup:
+    case ArgType::AtLeastOneGroup: {
+        const auto &children = static_cast<const GroupIface &>(arg).children();
+
+        return std::any_of(children.cbegin(), children.cend(), isDefined);
+    }
+
+    case ArgType::AllOfGroup: {
+        const auto &children = static_cast<const GroupIface &>(arg).children();
+
+        return std::all_of(children.cbegin(), children.cend(), isDefined);
+    }
+
+    default: {
+        const auto *p = parsed(arg);
+
+        return (p && p->m_isDefined);
+    }
+    }
+}
+
+inline bool ParseResult::isDefined(const String &name) const
+{
+    const auto *arg = (m_cmdLine ? m_cmdLine->lookup(name, m_state) : nullptr);
+
+    return (arg ? isDefined(*arg) : false);
+}
+
+inline const String &ParseResult::value(const ArgIface &arg) const
+{
+    const auto *p = parsed(arg);
+
+    return (p && !p->m_values.empty() ? p->m_values.front() : arg.defaultValue());
+}
+
+inline const String &ParseResult::value(const String &name) const
+{
+    const auto *arg = (m_cmdLine ? m_cmdLine->lookup(name, m_state) : nullptr);
+
+    return (arg ? value(*arg) : details::DummyString<>::c_string);
+}
+
+inline ValuesView ParseResult::values(const ArgIface &arg) const
+{
+    const auto *p = parsed(arg);
+
+    if (p && !p->m_values.empty()) {
+        return ValuesView(p->m_values);
+    }
+
+    switch (arg.type()) {
+    case ArgType::Command:
+        return ValuesView(static_cast<const Command &>(arg).defaultValues());
+
+    case ArgType::Arg:
+        return ValuesView(arg.defaultValue());
+
+    case ArgType::MultiArg:
+        return ValuesView(static_cast<const MultiArg &>(arg).defaultValues());
+
+    default:
+        return ValuesView();
+    }
+}
+
+inline ValuesView ParseResult::values(const String &name) const
+{
+    const auto *arg = (m_cmdLine ? m_cmdLine->lookup(name, m_state) : nullptr);
+
+    return (arg ? values(*arg) : ValuesView());
+}
+
+inline std::size_t ParseResult::count(const ArgIface &arg) const
+{
+    if (!arg.isWithValue()) {
+        const auto *p = parsed(arg);
+
+        return (p ? p->m_count : 0);
+    }
+
+    return values(arg).size();
+}
+
+inline const Command *ParseResult::subCommand(const Command &cmd) const
+{
+    const auto *p = parsed(cmd);
+
+    return (p ? p->m_subCommand : nullptr);
+}
+
+//
+// Command
+//
+
+inline const details::NameIndex &Command::index() const
+{
+    if (m_indexGeneration != cmdLine()->m_generation) {
+        m_index.clear();
+
+        for (const auto &arg : m_children) {
+            details::indexArgument(m_index, arg.get());
+        }
+
+        m_indexGeneration = cmdLine()->m_generation;
+    }
+
+    return m_index;
+}
+
 } /* namespace Args */
 
 #include "help_printer.hpp"
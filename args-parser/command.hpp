@@ -11,14 +11,29 @@
 #include "api.hpp"
 #include "context.hpp"
 #include "enums.hpp"
+#include "exceptions.hpp"
 #include "group_iface.hpp"
+#include "name_index.hpp"
+#include "parse_error.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 #include "value_utils.hpp"
 
+// C++ include.
+#include <algorithm>
+#include <iterator>
+
 namespace Args
 {
 
+namespace details
+{
+
+class ArgsSink;
+class ResultSink;
+
+} /* namespace details */
+
 //
 // Command
 //
@@ -29,6 +44,8 @@ class Command : public GroupIface
     friend class CmdLine;
     friend class HelpPrinter;
     friend class Help;
+    friend class details::ArgsSink;
+    friend class details::ResultSink;
 
 public:
     template<typename T>
@@ -40,16 +57,17 @@ public:
         , m_isDefined(false)
         , m_isSubCommandRequired(isSubCommandRequired)
         , m_subCommand(nullptr)
+        , m_indexGeneration(0)
     {
         if (details::isArgument(name()) || details::isFlag(name())) {
-            throw BaseException(String(SL("Command's name can't "
-                                          "start with \"-\" whereas you are trying to set name to \""))
-                                + name()
-                                + SL("\"."));
+            ARGS_THROW(BaseException(String(SL("Command's name can't "
+                                               "start with \"-\" whereas you are trying to set name to \""))
+                                     + name()
+                                     + SL("\".")));
         }
 
         if (name().empty()) {
-            throw BaseException(String(SL("Command can't be with empty name.")));
+            ARGS_THROW(BaseException(String(SL("Command can't be with empty name."))));
         }
 
         switch (m_opt) {
@@ -167,6 +185,25 @@ public:
         }
     }
 
+    /*!
+        \return All values for this argument moved out of it.
+
+        After that values() returns default values. If there are no
+        values, default values are copied.
+    */
+    StringList takeValues()
+    {
+        if (!m_values.empty()) {
+            StringList tmp = std::move(m_values);
+
+            m_values.clear();
+
+            return tmp;
+        } else {
+            return m_defaultValues;
+        }
+    }
+
     //! Set default value. \note Value will be pushed back to the list
     //! of default values.
     Command &setDefaultValue(const String &v)
@@ -229,9 +266,7 @@ public:
     //! Clear state of the argument.
     void clear() override
     {
-        m_isDefined = false;
-
-        m_values.clear();
+        clearState();
 
         GroupIface::clear();
     }
@@ -242,9 +277,9 @@ public:
     Command &addArg(ArgPtr arg) override
     {
         if (arg->type() == ArgType::Command && m_opt != ValueOptions::NoValue) {
-            throw BaseException(
+            ARGS_THROW(BaseException(
                 String(SL("Addition of commands to command with "
-                          "value is disallowed.")));
+                          "value is disallowed."))));
         }
 
         if (std::find(m_children.cbegin(), m_children.cend(), arg) == m_children.cend()) {
@@ -253,6 +288,8 @@ public:
             }
 
             m_children.push_back(std::move(arg));
+
+            notifyTreeChanged();
         }
         return *this;
     }
@@ -296,7 +333,7 @@ protected:
         */
         const String &name)
     {
-        auto *arg = GroupIface::findArgument(name);
+        auto *arg = (cmdLine() ? index().find(name) : GroupIface::findArgument(name));
 
         if (!arg && m_subCommand) {
             return m_subCommand->findChild(name);
@@ -305,6 +342,21 @@ protected:
         return arg;
     }
 
+    /*!
+        \return Index of the names of children, i.e. of this scope.
+
+        \note Command should be added to the command line parser.
+    */
+    const details::NameIndex &index() const;
+
+    //! Set command line parser.
+    void setCmdLine(CmdLine *cmdLine) override
+    {
+        GroupIface::setCmdLine(cmdLine);
+
+        m_indexGeneration = 0;
+    }
+
     /*!
         Process argument's staff, for example take values from
         context. This method invokes exactly at that moment when
@@ -318,17 +370,11 @@ protected:
 
         switch (m_opt) {
         case ValueOptions::ManyValues: {
-            eatValues(ctx,
-                      m_values,
-                      String(SL("Command \"")) + name() + SL("\" requires value that wasn't presented."),
-                      cmdLine());
+            eatValues(ctx, m_values, this, cmdLine());
         } break;
 
         case ValueOptions::OneValue: {
-            m_values.push_back(
-                eatOneValue(ctx,
-                            String(SL("Command \"")) + name() + SL("\" requires value that wasn't presented."),
-                            cmdLine()));
+            m_values.push_back(eatOneValue(ctx, this, cmdLine()));
         } break;
 
         default:
@@ -352,21 +398,26 @@ protected:
             auto it = std::find(names.begin(), names.end(), name());
 
             if (it != names.end()) {
-                throw BaseException(String(SL("Redefinition of command "
-                                              "with name \""))
-                                    + name()
-                                    + SL("\"."));
+                ARGS_THROW(BaseException(String(SL("Redefinition of command "
+                                                   "with name \""))
+                                         + name()
+                                         + SL("\".")));
             } else {
                 names.push_back(name());
             }
         } else {
-            throw BaseException(String(SL("Disallowed name \"")) + name() + SL("\" for the command."));
+            ARGS_THROW(BaseException(String(SL("Disallowed name \"")) + name() + SL("\" for the command.")));
         }
 
-        StringList ftmp = flags;
-        StringList ntmp = names;
+        // Names of the children are visible only in the scope of the
+        // command, so they are removed after the check.
+        const auto flagsCount = flags.size();
+        const auto namesCount = names.size();
+
+        GroupIface::checkCorrectnessBeforeParsing(flags, names);
 
-        GroupIface::checkCorrectnessBeforeParsing(ftmp, ntmp);
+        flags.erase(std::next(flags.begin(), flagsCount), flags.end());
+        names.erase(std::next(names.begin(), namesCount), names.end());
     }
 
     //! Check correctness of the argument after parsing.
@@ -377,7 +428,7 @@ protected:
         }
 
         if (isDefined() && m_isSubCommandRequired && !m_subCommand) {
-            throw BaseException(String(SL("Wasn't defined required sub-command of command \"")) + name() + SL("\"."));
+            details::reportError(cmdLine(), ParseError(ParseErrorCode::RequiredSubCommandNotDefined, this));
         }
     }
 
@@ -387,6 +438,16 @@ protected:
         m_subCommand = sub;
     }
 
+    //! Clear state of the command without children.
+    void clearState()
+    {
+        m_isDefined = false;
+
+        m_values.clear();
+
+        m_subCommand = nullptr;
+    }
+
 private:
     DISABLE_COPY(Command)
 
@@ -408,6 +469,10 @@ private:
     StringList m_defaultValues;
     //! Current sub-command.
     Command *m_subCommand;
+    //! Generation of the tree of arguments the index was built for.
+    mutable std::size_t m_indexGeneration;
+    //! Index of the names of children.
+    mutable details::NameIndex m_index;
 }; // class Command
 
 } /* namespace Args */
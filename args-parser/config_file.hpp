@@ -0,0 +1,175 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__CONFIG_FILE_HPP__INCLUDED
+#define ARGS__CONFIG_FILE_HPP__INCLUDED
+
+// Args include.
+#include "mapped_file.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <vector>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// ConfigEntry
+//
+
+//! Entry of the config file, i.e. "key = value" line.
+struct ConfigEntry {
+    //! Key, i.e. name of the argument.
+    StringView m_key;
+    //! Value.
+    StringView m_value;
+    //! Was "=" in the line?
+    bool m_hasValue;
+}; // struct ConfigEntry
+
+//
+// ConfigFile
+//
+
+/*!
+    Config file with "key = value" lines.
+
+    Lines starting with "#" or ";" are comments. Spaces around the key
+    and the value are ignored, value can be quoted with single or double
+    quotes to keep them. Line without "=" is a key without value, i.e.
+    a flag. Sections aren't supported.
+
+    File is mapped into the memory, keys and values are views to the
+    mapping, so nothing is copied.
+*/
+class ConfigFile final
+{
+public:
+    ConfigFile()
+    {
+    }
+
+    /*!
+        Open the file with the given name and split it into entries.
+
+        \return false if the file can't be read or has an invalid line,
+            \a invalid is the invalid line then.
+    */
+    bool open(const String &name,
+              StringView &invalid)
+    {
+        m_name = name;
+
+        if (!m_file.open(m_name)) {
+            return false;
+        }
+
+        for (Char *pos = m_file.begin(), *end = m_file.end(); pos != end;) {
+            Char *last = pos;
+
+            while (last != end && *last != Char(SL('\n'))) {
+                ++last;
+            }
+
+            const StringView line = trim(StringView(pos, static_cast<std::size_t>(last - pos)));
+
+            pos = (last != end ? last + 1 : last);
+
+            if (line.empty() || line[0] == Char(SL('#')) || line[0] == Char(SL(';'))) {
+                continue;
+            }
+
+            const String::size_type eq = line.find(Char(SL('=')));
+
+            ConfigEntry entry{trim(line.substr(0, eq)), StringView(), eq != String::npos};
+
+            if (entry.m_hasValue) {
+                entry.m_value = unquote(trim(line.substr(eq + 1)));
+            }
+
+            if (entry.m_key.empty() || line[0] == Char(SL('['))) {
+                invalid = line;
+
+                return false;
+            }
+
+            m_entries.push_back(entry);
+        }
+
+        return true;
+    }
+
+    //! \return Name of the file.
+    const String &name() const
+    {
+        return m_name;
+    }
+
+    //! \return Entries in the order of the lines.
+    const std::vector<ConfigEntry> &entries() const
+    {
+        return m_entries;
+    }
+
+private:
+    DISABLE_COPY(ConfigFile)
+
+    //! \return Is the character a white space?
+    static bool isSpace(Char c)
+    {
+        const std::size_t code = charCode(c);
+
+        return (code == ' ' || code == '\t' || code == '\r' || code == '\v' || code == '\f');
+    }
+
+    //! \return String without white spaces at the begin and at the end.
+    static StringView trim(StringView s)
+    {
+        std::size_t first = 0;
+        std::size_t last = s.size();
+
+        while (first != last && isSpace(s[first])) {
+            ++first;
+        }
+
+        while (last != first && isSpace(s[last - 1])) {
+            --last;
+        }
+
+        return s.substr(first, last - first);
+    }
+
+    //! \return String without quotes.
+    static StringView unquote(StringView s)
+    {
+        if (s.size() >= 2 && s[0] == s[s.size() - 1] && (s[0] == Char(SL('"')) || s[0] == Char(SL('\'')))) {
+            return s.substr(1, s.size() - 2);
+        }
+
+        return s;
+    }
+
+private:
+    //! Name of the file.
+    String m_name;
+    //! File.
+    MappedFile m_file;
+    //! Entries.
+    std::vector<ConfigEntry> m_entries;
+}; // class ConfigFile
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__CONFIG_FILE_HPP__INCLUDED
@@ -8,22 +8,58 @@
 #define ARGS__CONTEXT_HPP__INCLUDED
 
 // C++ include.
+#include <cstddef>
 #include <utility>
+#include <vector>
 
 // Args include.
+#include "response_file.hpp"
+#include "string_view.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 
 namespace Args
 {
 
+namespace details
+{
+
+//
+// TokenTag
+//
+
+//! Class of the word in the context.
+enum class TokenTag : unsigned char {
+    //! Word isn't classified and should be looked up.
+    Unknown,
+    //! Word isn't known in any scope, i.e. value.
+    Value,
+    //! Name of the argument known in some scope, i.e. "--timeout".
+    LongOption,
+    //! Block of flags known in some scope, i.e. "-vt".
+    FlagBlock,
+    //! Name of the command known in some scope.
+    Command,
+    //! Separator "--".
+    Separator
+}; // enum class TokenTag
+
+} /* namespace details */
+
 //
 // ContextInternal
 //
 
-//! What Context actually is.
+//! Words owned by the context.
 typedef StringList ContextInternal;
 
+//
+// ContextView
+//
+
+//! What Context actually is, views to the words owned by the context or by someone else.
+typedef std::vector<details::StringView> ContextView;
+
 //
 // Context
 //
@@ -31,51 +67,176 @@ typedef StringList ContextInternal;
 /*!
     Context is a list of words in the command line that user
     presented with interface for interacting with them.
+
+    Words are not copied when context is made from the views, i.e.
+    from argv, in this case viewed words should outlive the context.
+    Owning String is made only when the word is taken as String.
 */
 class Context final
 {
 public:
     Context()
         : m_it(m_context.begin())
+        , m_pos(0)
+        , m_dropped(0)
     {
     }
 
+    //! Construct context owning the given words.
     explicit Context(ContextInternal items);
 
+    //! Construct context over the given views.
+    explicit Context(ContextView items);
+
     Context &operator=(ContextInternal &&items)
+    {
+        m_storage = std::move(items);
+
+        ContextView views;
+        views.reserve(m_storage.size());
+
+        for (const auto &s : details::asConst(m_storage)) {
+            views.push_back(s);
+        }
+
+        return (*this = std::move(views));
+    }
+
+    Context &operator=(ContextView &&items)
     {
         m_context = std::move(items);
 
         m_it = m_context.begin();
+        m_tokens.clear();
+        m_pos = 0;
+        m_dropped = 0;
+        m_responseFiles.clear();
 
         return *this;
     }
 
     //! \return Iterator to the first item in the context.
-    ContextInternal::iterator begin();
+    ContextView::iterator begin();
 
     //! \return Iterator to the last item in the context.
-    ContextInternal::iterator end();
+    ContextView::iterator end();
 
     //! \return Is context at end?
     bool atEnd();
 
     //! \return Iterator to the next item in the context.
-    ContextInternal::iterator next();
+    ContextView::iterator next();
 
     //! Put back last taken item.
     void putBack();
 
-    //! Prepend context with new item.
-    void prepend(const String &what);
+    /*!
+        Put back the part of the last taken item after the given
+        position, i.e. "value" of "--name=value", so it will be the
+        next item. Nothing is copied or inserted.
+    */
+    void putBackValue(String::size_type splitOffset);
+
+    /*!
+        Classify all items of the context once.
+
+        \a classifier is invoked as classifier(word, splitOffset) and
+        should return details::TokenTag of the word, where splitOffset
+        is the position of the first "=" in the word or String::npos.
+    */
+    template<typename Classifier>
+    void classify(Classifier classifier);
+
+    /*!
+        Feed the context incrementally, i.e. drop taken items and append
+        the given words classified with \a classifier as classify() does.
+        Index of the item, pos(), continues to grow.
+
+        \note Should be done between taking the words, views to the
+            dropped items aren't used by the context anymore.
+    */
+    template<typename Classifier>
+    void feed(const ContextView &words,
+              Classifier classifier);
+
+    /*!
+        Replace items starting with the given index, as pos() returns,
+        with the given words classified with \a classifier as classify()
+        does, and continue from the item with this index. Items before
+        it keep their classes.
+
+        \note Dropped items can't be replaced.
+    */
+    template<typename Classifier>
+    void replace(std::size_t pos,
+                 const ContextView &words,
+                 Classifier classifier);
+
+    //! \return Count of items not taken yet.
+    std::size_t remaining() const
+    {
+        return static_cast<std::size_t>(m_context.cend() - ContextView::const_iterator(m_it));
+    }
+
+    //! \return Tag of the item at the given offset from the current one.
+    details::TokenTag tag(std::size_t offset = 0) const;
+
+    //! \return Position of the first "=" in the word at the given offset
+    //! from the current one or String::npos.
+    String::size_type splitOffset(const details::StringView &word,
+                                  std::size_t offset = 0) const;
+
+    /*!
+        Replace "@file" items with the words of the response files,
+        should be done before taking items.
+
+        \return false if the response file includes itself, see
+            details::ResponseFiles::expand().
+    */
+    bool expandResponseFiles(std::size_t &failed,
+                             String &fileName);
+
+    //! \return Response files items of the context refer to.
+    const details::ResponseFiles &responseFiles() const
+    {
+        return m_responseFiles;
+    }
+
+    //! \return Index of the current item, i.e. of the item next() returns.
+    std::size_t pos() const
+    {
+        return m_dropped + m_pos;
+    }
 
 private:
     DISABLE_COPY(Context)
 
+    //! Classify items not classified yet.
+    template<typename Classifier>
+    void classifyRest(Classifier classifier);
+
+    //! Classified item.
+    struct Token {
+        //! Tag.
+        details::TokenTag m_tag;
+        //! Position of the first "=".
+        String::size_type m_splitOffset;
+    }; // struct Token
+
     //! Internal representation of the context.
-    ContextInternal m_context;
+    ContextView m_context;
     //! Iterator to the current item in the context.
-    ContextInternal::iterator m_it;
+    ContextView::iterator m_it;
+    //! Owned words.
+    ContextInternal m_storage;
+    //! Classified items, empty if context isn't classified.
+    std::vector<Token> m_tokens;
+    //! Position of the current item in the context.
+    std::size_t m_pos;
+    //! Count of items dropped with feed().
+    std::size_t m_dropped;
+    //! Response files items refer to.
+    details::ResponseFiles m_responseFiles;
 }; // class Context
 
 //
@@ -83,17 +244,27 @@ private:
 //
 
 inline Context::Context(ContextInternal items)
+    : m_it(m_context.begin())
+    , m_pos(0)
+    , m_dropped(0)
+{
+    *this = std::move(items);
+}
+
+inline Context::Context(ContextView items)
     : m_context(std::move(items))
     , m_it(m_context.begin())
+    , m_pos(0)
+    , m_dropped(0)
 {
 }
 
-inline ContextInternal::iterator Context::begin()
+inline ContextView::iterator Context::begin()
 {
     return m_it;
 }
 
-inline ContextInternal::iterator Context::end()
+inline ContextView::iterator Context::end()
 {
     return m_context.end();
 }
@@ -103,11 +274,13 @@ inline bool Context::atEnd()
     return (begin() == end());
 }
 
-inline ContextInternal::iterator Context::next()
+inline ContextView::iterator Context::next()
 {
     if (atEnd()) {
         return end();
     } else {
+        ++m_pos;
+
         return m_it++;
     }
 }
@@ -116,12 +289,124 @@ inline void Context::putBack()
 {
     if (begin() != m_context.begin()) {
         --m_it;
+        --m_pos;
     }
 }
 
-inline void Context::prepend(const String &what)
+inline void Context::putBackValue(String::size_type splitOffset)
 {
-    m_it = m_context.insert(m_it, what);
+    if (begin() != m_context.begin()) {
+        --m_it;
+        --m_pos;
+
+        *m_it = m_it->substr(static_cast<std::size_t>(splitOffset) + 1);
+
+        if (m_pos < m_tokens.size()) {
+            m_tokens[m_pos] = Token{details::TokenTag::Unknown, m_it->find(Char(SL('=')))};
+        }
+    }
+}
+
+inline bool Context::expandResponseFiles(std::size_t &failed,
+                                         String &fileName)
+{
+    if (!m_responseFiles.expand(m_context, failed, fileName)) {
+        return false;
+    }
+
+    m_it = m_context.begin();
+    m_tokens.clear();
+    m_pos = 0;
+
+    return true;
+}
+
+template<typename Classifier>
+inline void Context::classify(Classifier classifier)
+{
+    m_tokens.clear();
+    m_tokens.reserve(m_context.size());
+
+    for (const auto &word : details::asConst(m_context)) {
+        const String::size_type splitOffset = word.find(Char(SL('=')));
+
+        m_tokens.push_back(Token{classifier(word, splitOffset), splitOffset});
+    }
+}
+
+template<typename Classifier>
+inline void Context::feed(const ContextView &words,
+                          Classifier classifier)
+{
+    const bool isClassified = (m_tokens.size() == m_context.size());
+
+    m_context.erase(m_context.begin(), m_it);
+
+    if (isClassified) {
+        m_tokens.erase(m_tokens.begin(), m_tokens.begin() + static_cast<std::ptrdiff_t>(m_pos));
+    } else {
+        m_tokens.clear();
+    }
+
+    m_dropped += m_pos;
+    m_pos = 0;
+
+    m_context.insert(m_context.end(), words.cbegin(), words.cend());
+    m_it = m_context.begin();
+
+    classifyRest(classifier);
+}
+
+template<typename Classifier>
+inline void Context::replace(std::size_t pos,
+                             const ContextView &words,
+                             Classifier classifier)
+{
+    const bool isClassified = (m_tokens.size() == m_context.size());
+    const std::size_t first = pos - m_dropped;
+
+    m_context.erase(m_context.begin() + static_cast<std::ptrdiff_t>(first), m_context.end());
+
+    if (isClassified) {
+        m_tokens.resize(first);
+    } else {
+        m_tokens.clear();
+    }
+
+    m_context.insert(m_context.end(), words.cbegin(), words.cend());
+    m_it = m_context.begin() + static_cast<std::ptrdiff_t>(first);
+    m_pos = first;
+
+    classifyRest(classifier);
+}
+
+template<typename Classifier>
+inline void Context::classifyRest(Classifier classifier)
+{
+    for (auto it = m_context.cbegin() + static_cast<std::ptrdiff_t>(m_tokens.size()); it != m_context.cend(); ++it) {
+        const String::size_type splitOffset = it->find(Char(SL('=')));
+
+        m_tokens.push_back(Token{classifier(*it, splitOffset), splitOffset});
+    }
+}
+
+inline details::TokenTag Context::tag(std::size_t offset) const
+{
+    if (m_pos + offset < m_tokens.size()) {
+        return m_tokens[m_pos + offset].m_tag;
+    } else {
+        return details::TokenTag::Unknown;
+    }
+}
+
+inline String::size_type Context::splitOffset(const details::StringView &word,
+                                              std::size_t offset) const
+{
+    if (m_pos + offset < m_tokens.size()) {
+        return m_tokens[m_pos + offset].m_splitOffset;
+    } else {
+        return word.find(Char(SL('=')));
+    }
 }
 
 } /* namespace Args */
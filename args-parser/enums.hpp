@@ -44,6 +44,50 @@ enum class ArgType {
     AtLeastOneGroup
 }; // enum class ArgType
 
+//
+// ParseErrorCode
+//
+
+//! Code of the error of parsing.
+enum class ParseErrorCode {
+    //! No error.
+    NoError = 0,
+    //! Unknown argument or command.
+    UnknownArgument,
+    //! Prefix of the name matches several arguments.
+    AmbiguousArgument,
+    //! Unknown flag in the flags combo.
+    UnknownFlag,
+    //! Argument with value not at the end of the flags combo.
+    FlagsComboWithValue,
+    //! Argument or command requires value that wasn't presented.
+    ValueRequired,
+    //! Value can't be converted to the type of the argument.
+    InvalidValue,
+    //! Response file includes itself.
+    RecursiveResponseFile,
+    //! Key of the config file isn't a name of an argument.
+    UnknownConfigKey,
+    //! Argument already defined.
+    AlreadyDefined,
+    //! Several commands from one level.
+    OnlyOneCommand,
+    //! Command is required but wasn't specified.
+    CommandNotSpecified,
+    //! Required argument wasn't defined.
+    RequiredArgumentNotDefined,
+    //! Required sub-command wasn't defined.
+    RequiredSubCommandNotDefined,
+    //! Several arguments of the OnlyOne group were defined.
+    OnlyOneGroupViolated,
+    //! Not all arguments of the AllOf group were defined.
+    AllOfGroupViolated,
+    //! Help has been printed.
+    HelpPrinted,
+    //! Other error, see message.
+    Other
+}; // enum class ParseErrorCode
+
 } /* namespace Args */
 
 #endif // ARGS__ENUMS_HPP__INCLUDED
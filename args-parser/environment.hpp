@@ -0,0 +1,242 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__ENVIRONMENT_HPP__INCLUDED
+#define ARGS__ENVIRONMENT_HPP__INCLUDED
+
+// Args include.
+#include "local_string.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __APPLE__
+#include <crt_externs.h>
+#elif !defined(_WIN32)
+extern char **environ;
+#endif
+
+namespace Args
+{
+
+class ArgIface;
+class Command;
+
+namespace details
+{
+
+//
+// environment
+//
+
+//! \return Environment of the process, "NAME=value" strings ending with nullptr.
+static inline char **environment()
+{
+#ifdef _WIN32
+    return _environ;
+#elif defined(__APPLE__)
+    return *_NSGetEnviron();
+#else
+    return environ;
+#endif
+} // environment
+
+//
+// EnvBindings
+//
+
+/*!
+    Arguments bound to the environment variables.
+
+    Names of the variables are kept in the hash table, so values of all
+    the bound variables are found with one scan of the environment,
+    without getenv() for each argument.
+*/
+class EnvBindings final
+{
+public:
+    //! Binding of the argument.
+    struct Binding {
+        //! Argument.
+        ArgIface *m_arg;
+        //! Command the argument belongs to, nullptr for the top level.
+        Command *m_command;
+        //! Name of the variable in the local 8-bit encoding.
+        std::string m_name;
+        //! Hash of the name.
+        std::size_t m_hash;
+    }; // struct Binding
+
+    //! Value of the variable.
+    struct Value {
+        Value()
+            : m_isSet(false)
+        {
+        }
+
+        //! Is the variable set?
+        bool m_isSet;
+        //! Value.
+        StringView m_value;
+#if defined(ARGS_WSTRING_BUILD) || defined(ARGS_QSTRING_BUILD)
+        //! Decoded value.
+        String m_text;
+#endif
+    }; // struct Value
+
+    EnvBindings()
+    {
+    }
+
+    //! Bind the argument to the variable. Name that can't be encoded is ignored.
+    void add(ArgIface *arg,
+             Command *cmd,
+             const String &name)
+    {
+        Binding binding{arg, cmd, std::string(), 0};
+
+        if (!toLocal8Bit(name, binding.m_name) || binding.m_name.empty()) {
+            return;
+        }
+
+        binding.m_hash = hashString(binding.m_name.cbegin(), binding.m_name.cend());
+
+        m_bindings.push_back(std::move(binding));
+
+        if (m_slots.size() < m_bindings.size() * 2) {
+            rehash(m_bindings.size() * 4);
+        } else {
+            insert(m_bindings.size() - 1);
+        }
+    }
+
+    //! Remove all the bindings.
+    void clear()
+    {
+        m_bindings.clear();
+        m_slots.clear();
+    }
+
+    //! \return Is there no bindings?
+    bool empty() const
+    {
+        return m_bindings.empty();
+    }
+
+    //! \return Bindings in the order of the arguments in the tree.
+    const std::vector<Binding> &bindings() const
+    {
+        return m_bindings;
+    }
+
+    //! Find values of the bound variables, indexed as bindings(), with one scan of the environment.
+    void resolve(std::vector<Value> &values) const
+    {
+        values.assign(m_bindings.size(), Value());
+
+        if (m_bindings.empty()) {
+            return;
+        }
+
+        const std::size_t mask = m_slots.size() - 1;
+
+        for (char **env = environment(); env && *env; ++env) {
+            const char *first = *env;
+            const char *last = first;
+            std::size_t hash = 2166136261u;
+
+            // Hash of the name is counted while looking for "=", the same way as hashString() does.
+            for (; *last && *last != '='; ++last) {
+                hash ^= charCode(*last);
+                hash *= 16777619u;
+            }
+
+            if (!*last) {
+                continue;
+            }
+
+            const std::size_t length = static_cast<std::size_t>(last - first);
+
+            // Several arguments may be bound to one variable.
+            for (std::size_t i = hash & mask; m_slots[i] != c_noBinding; i = (i + 1) & mask) {
+                const Binding &binding = m_bindings[m_slots[i]];
+
+                if (binding.m_hash == hash && binding.m_name.compare(0, std::string::npos, first, length) == 0) {
+                    setValue(values[m_slots[i]], last + 1);
+                }
+            }
+        }
+    }
+
+private:
+    DISABLE_COPY(EnvBindings)
+
+    //! Index of the empty slot.
+    enum : std::size_t { c_noBinding = static_cast<std::size_t>(-1) };
+
+    //! Rebuild hash table of the names with the given count of slots, power of 2.
+    void rehash(std::size_t capacity)
+    {
+        std::size_t size = 8;
+
+        while (size < capacity) {
+            size *= 2;
+        }
+
+        m_slots.assign(size, static_cast<std::size_t>(c_noBinding));
+
+        for (std::size_t b = 0; b < m_bindings.size(); ++b) {
+            insert(b);
+        }
+    }
+
+    //! Insert binding with the given index into the hash table.
+    void insert(std::size_t b)
+    {
+        const std::size_t mask = m_slots.size() - 1;
+
+        std::size_t i = m_bindings[b].m_hash & mask;
+
+        while (m_slots[i] != c_noBinding) {
+            i = (i + 1) & mask;
+        }
+
+        m_slots[i] = b;
+    }
+
+    //! Set value of the variable.
+    static void setValue(Value &res,
+                         const char *value)
+    {
+        res.m_isSet = true;
+
+#if defined(ARGS_WSTRING_BUILD) || defined(ARGS_QSTRING_BUILD)
+        res.m_text = fromLocal8Bit(value, std::strlen(value));
+        res.m_value = res.m_text;
+#else
+        res.m_value = StringView(value, std::strlen(value));
+#endif
+    }
+
+private:
+    //! Bindings in the order of the arguments in the tree.
+    std::vector<Binding> m_bindings;
+    //! Hash table of the names, indexes of the bindings.
+    std::vector<std::size_t> m_slots;
+}; // class EnvBindings
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__ENVIRONMENT_HPP__INCLUDED
@@ -8,11 +8,32 @@
 #define ARGS__EXCEPTIONS_HPP__INCLUDED
 
 // C++ include.
+#include <cstdlib>
 #include <stdexcept>
 
 // Args include.
 #include "types.hpp"
 
+//
+// ARGS_NO_EXCEPTIONS
+//
+
+//! Defined if the library is compiled without exceptions, i.e. with -fno-exceptions.
+#if !defined(ARGS_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#define ARGS_NO_EXCEPTIONS
+#endif
+
+//
+// ARGS_THROW
+//
+
+//! Throw exception, or print it and abort if exceptions are disabled.
+#ifdef ARGS_NO_EXCEPTIONS
+#define ARGS_THROW(Exception) ::Args::details::abortWith(Exception)
+#else
+#define ARGS_THROW(Exception) throw Exception
+#endif
+
 namespace Args
 {
 
@@ -59,6 +80,24 @@ public:
     }
 }; // class HelpHasBeenPrintedException
 
+namespace details
+{
+
+//
+// abortWith
+//
+
+//! Print description of the exception and abort. Used when exceptions are disabled.
+[[noreturn]] static inline void abortWith(const BaseException &x)
+{
+    outStream() << x.desc() << SL("\n");
+    outStream().flush();
+
+    std::abort();
+} // abortWith
+
+} /* namespace details */
+
 } /* namespace Args */
 
 #endif // ARGS__EXCEPTIONS_HPP__INCLUDED
@@ -10,6 +10,7 @@
 // Args include.
 #include "arg_iface.hpp"
 #include "exceptions.hpp"
+#include "parse_error.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 
@@ -77,6 +78,8 @@ public:
             }
 
             m_children.push_back(std::move(arg));
+
+            notifyTreeChanged();
         }
         return *this;
     }
@@ -108,6 +111,7 @@ public:
     virtual GroupIface &setRequired(bool on = true)
     {
         m_required = on;
+        notifyTreeChanged();
         return *this;
     }
 
@@ -214,7 +218,7 @@ protected:
         }
 
         if (isRequired() && !isDefined()) {
-            throw BaseException(String(SL("Not defined required argument \"")) + name() + SL("\""));
+            details::reportError(cmdLine(), ParseError(ParseErrorCode::RequiredArgumentNotDefined, this));
         }
     }
 
@@ -14,7 +14,9 @@
 #define ARGS__GROUPS_HPP__INCLUDED
 
 // Args include.
+#include "exceptions.hpp"
 #include "group_iface.hpp"
+#include "parse_error.hpp"
 #include "types.hpp"
 
 // C++ include.
@@ -74,11 +76,11 @@ protected:
 
         for (const auto &arg : details::asConst(children())) {
             if (arg->isRequired()) {
-                throw BaseException(String(SL("Required argument \""))
-                                    + arg->name()
-                                    + SL("\" is not allowed to be in OnlyOne group \"")
-                                    + name()
-                                    + SL("\"."));
+                ARGS_THROW(BaseException(String(SL("Required argument \""))
+                                         + arg->name()
+                                         + SL("\" is not allowed to be in OnlyOne group \"")
+                                         + name()
+                                         + SL("\".")));
             }
         }
     }
@@ -93,15 +95,10 @@ protected:
         for (const auto &arg : details::asConst(children())) {
             if (arg->isDefined()) {
                 if (defined) {
-                    throw BaseException(String(SL("Only one argument can "
-                                                  "be defined in OnlyOne group \""))
-                                        + name()
-                                        + SL("\". ")
-                                        + SL("Whereas defined \"")
-                                        + defined->name()
-                                        + SL("\" and \"")
-                                        + arg->name()
-                                        + SL("\"."));
+                    details::reportError(cmdLine(),
+                                         ParseError(ParseErrorCode::OnlyOneGroupViolated, arg.get(), defined, this));
+
+                    return;
                 } else {
                     defined = arg.get();
                 }
@@ -161,12 +158,12 @@ protected:
 
         for (const auto &arg : details::asConst(children())) {
             if (arg->isRequired()) {
-                throw BaseException(String(SL("Required argument \""))
-                                    + arg->name()
-                                    + SL("\" is not allowed to ")
-                                    + SL("be in AllOf group \"")
-                                    + name()
-                                    + SL("\"."));
+                ARGS_THROW(BaseException(String(SL("Required argument \""))
+                                         + arg->name()
+                                         + SL("\" is not allowed to ")
+                                         + SL("be in AllOf group \"")
+                                         + name()
+                                         + SL("\".")));
             }
         }
     }
@@ -185,10 +182,7 @@ protected:
         });
 
         if (defined && !all) {
-            throw BaseException(String(SL("All arguments in "
-                                          "AllOf group \""))
-                                + name()
-                                + SL("\" should be defined."));
+            details::reportError(cmdLine(), ParseError(ParseErrorCode::AllOfGroupViolated, nullptr, nullptr, this));
         }
     }
 }; // class AllOfGroup
@@ -244,12 +238,12 @@ protected:
 
         for (const auto &arg : details::asConst(children())) {
             if (arg->isRequired()) {
-                throw BaseException(String(SL("Required argument \""))
-                                    + arg->name()
-                                    + SL("\" is not allowed to ")
-                                    + SL("be in AtLeastOne group \"")
-                                    + name()
-                                    + SL("\"."));
+                ARGS_THROW(BaseException(String(SL("Required argument \""))
+                                         + arg->name()
+                                         + SL("\" is not allowed to ")
+                                         + SL("be in AtLeastOne group \"")
+                                         + name()
+                                         + SL("\".")));
             }
         }
     }
@@ -13,6 +13,7 @@
 #include "context.hpp"
 #include "exceptions.hpp"
 #include "help_printer_iface.hpp"
+#include "parse_error.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 
@@ -175,7 +176,7 @@ inline void Help::process(Context &context)
     setDefined(true);
 
     if (m_throwExceptionOnPrint) {
-        throw HelpHasBeenPrintedException();
+        details::reportError(cmdLine(), ParseError(ParseErrorCode::HelpPrinted, this));
     }
 }
 
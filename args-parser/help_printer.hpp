@@ -98,6 +98,12 @@ private:
                            String::size_type currentPos,
                            String::size_type leftMargin,
                            String::size_type rightMargin) const;
+    //! Print environment variable.
+    void printEnvVar(ArgIface *arg,
+                     OutStreamType &to,
+                     String::size_type currentPos,
+                     String::size_type leftMargin,
+                     String::size_type rightMargin) const;
     //! Sort argument.
     void sortArg(const ArgPtr &arg,
                  std::vector<Command *> &commands,
@@ -285,6 +291,8 @@ inline void HelpPrinter::printOnlyFor(ArgIface *arg,
 
     printDefaultValue(arg, to, 0, beforeDescription, 0);
 
+    printEnvVar(arg, to, 0, beforeDescription, 0);
+
     to.flush();
 }
 
@@ -668,6 +676,24 @@ inline void HelpPrinter::printDefaultValue(ArgIface *arg,
     }
 }
 
+inline void HelpPrinter::printEnvVar(ArgIface *arg,
+                                     OutStreamType &to,
+                                     String::size_type currentPos,
+                                     String::size_type leftMargin,
+                                     String::size_type rightMargin) const
+{
+    if (!arg->envVar().empty()) {
+        StringList words;
+        words.push_back(String("Environment"));
+        words.push_back(String("variable:"));
+        words.push_back(arg->envVar());
+
+        printString(to, words, currentPos, leftMargin, rightMargin);
+
+        to << "\n" << "\n";
+    }
+}
+
 inline void HelpPrinter::print(ArgIface *arg,
                                OutStreamType &to) const
 {
@@ -687,6 +713,8 @@ inline void HelpPrinter::print(ArgIface *arg,
 
     printDefaultValue(arg, to, 0, 7, 7);
 
+    printEnvVar(arg, to, 0, 7, 7);
+
     to.flush();
 }
 
@@ -0,0 +1,233 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__LIST_ARG_HPP__INCLUDED
+#define ARGS__LIST_ARG_HPP__INCLUDED
+
+// Args include.
+#include "context.hpp"
+#include "exceptions.hpp"
+#include "multi_arg.hpp"
+#include "parse_error.hpp"
+#include "string_view.hpp"
+#include "typed_arg.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include "value_utils.hpp"
+
+// C++ include.
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Args
+{
+
+//
+// ListArg
+//
+
+/*!
+    Argument with the list of numbers, i.e. "--ids 1,2,3" or
+    "--ids 1 2 3" or both, converted to T once on parsing.
+
+    Each value is split on the delimiter and its items are converted
+    in place right into typedValues(), no strings are made for the
+    items and for the values. Value with item that can't be converted
+    is reported as ParseErrorCode::InvalidValue.
+
+    \note values() of the argument is not filled on parsing, only
+        default values are there.
+*/
+template<typename T>
+class ListArg : public MultiArg
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "ListArg supports only integer and floating point types.");
+
+public:
+    //! Construct argument with flag and name.
+    template<typename N>
+    ListArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Name for this argument.
+        N &&name,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(flag,
+                   std::forward<N>(name),
+                   true,
+                   isRequired)
+        , m_delimiter(SL(','))
+    {
+    }
+
+    //! Construct argument only with flag, without name.
+    explicit ListArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(flag,
+                   true,
+                   isRequired)
+        , m_delimiter(SL(','))
+    {
+    }
+
+    //! Construct argument only with name, without flag.
+    template<typename N>
+    explicit ListArg(
+        //! Name for this argument.
+        N &&name,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(std::forward<N>(name),
+                   true,
+                   isRequired)
+        , m_delimiter(SL(','))
+    {
+    }
+
+    virtual ~ListArg()
+    {
+    }
+
+    //! \return Delimiter of the items.
+    Char delimiter() const
+    {
+        return m_delimiter;
+    }
+
+    //! Set delimiter of the items, "," by default.
+    ListArg &setDelimiter(Char d)
+    {
+        m_delimiter = d;
+        return *this;
+    }
+
+    //! \return Converted items of this argument or converted default items.
+    const std::vector<T> &typedValues() const
+    {
+        return (isDefined() ? m_items : m_defaultItems);
+    }
+
+    //! \return Count of the items.
+    std::size_t count() const
+    {
+        return typedValues().size();
+    }
+
+    /*!
+        Set default value, it's split on the delimiter too.
+        \note Items will be pushed back to the list of default items.
+
+        \throw BaseException if any item can't be converted to T.
+    */
+    ListArg &setDefaultValue(const String &v) override
+    {
+        if (!parseList(v.data(), v.data() + v.size(), m_defaultItems, m_buf)) {
+            ARGS_THROW(BaseException(String(SL("Invalid default value \""))
+                                     + v
+                                     + SL("\" of argument \"")
+                                     + name()
+                                     + SL("\".")));
+        }
+
+        MultiArg::setDefaultValue(v);
+
+        return *this;
+    }
+
+    //! \return Can all items of the given string be converted to T?
+    bool isValueValid(const String &value) const override
+    {
+        std::vector<T> items;
+        std::string buf;
+
+        return parseList(value.data(), value.data() + value.size(), items, buf);
+    }
+
+    //! Clear state of the argument.
+    void clear() override
+    {
+        MultiArg::clear();
+
+        m_items.clear();
+    }
+
+protected:
+    //! Process argument and convert items of all its values.
+    void process(
+        //! Context of the command line.
+        Context &context) override
+    {
+        details::convertValues(context, this, cmdLine(), [this](const details::StringView &word) {
+            return parseList(word.begin(), word.end(), m_items, m_buf);
+        });
+    }
+
+private:
+    /*!
+        Append items of the given range to \a items.
+
+        \return false if any item is invalid, \a items aren't changed then.
+    */
+    bool parseList(const Char *first,
+                   const Char *last,
+                   std::vector<T> &items,
+                   //! Buffer for the conversion of floating point items.
+                   std::string &buf) const
+    {
+        const std::size_t itemsCount = items.size();
+        const std::size_t required = itemsCount + static_cast<std::size_t>(std::count(first, last, m_delimiter)) + 1;
+
+        // Grow geometrically, many short words shouldn't reallocate on each word.
+        if (required > items.capacity()) {
+            items.reserve(std::max(required, items.capacity() * 2));
+        }
+
+        for (;;) {
+            const Char *end = std::find(first, last, m_delimiter);
+
+            T item = T();
+
+            if (!details::fromChars(first, end, item, buf)) {
+                items.resize(itemsCount);
+
+                return false;
+            }
+
+            items.push_back(item);
+
+            if (end == last) {
+                return true;
+            }
+
+            first = end + 1;
+        }
+    }
+
+private:
+    DISABLE_COPY(ListArg)
+
+    //! Delimiter of the items.
+    Char m_delimiter;
+    //! Converted items.
+    std::vector<T> m_items;
+    //! Converted default items.
+    std::vector<T> m_defaultItems;
+    //! Buffer for the conversion of floating point items.
+    std::string m_buf;
+}; // class ListArg
+
+} /* namespace Args */
+
+#endif // ARGS__LIST_ARG_HPP__INCLUDED
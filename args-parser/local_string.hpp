@@ -0,0 +1,102 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__LOCAL_STRING_HPP__INCLUDED
+#define ARGS__LOCAL_STRING_HPP__INCLUDED
+
+// Args include.
+#include "string_view.hpp"
+#include "types.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <string>
+
+#ifdef ARGS_WSTRING_BUILD
+#include <climits>
+#include <cwchar>
+#endif
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// toLocal8Bit
+//
+
+//! Convert the string to the local 8-bit encoding. \return false if it can't be converted.
+static inline bool toLocal8Bit(const StringView &s,
+                               std::string &res)
+{
+#ifdef ARGS_WSTRING_BUILD
+    std::mbstate_t state = std::mbstate_t();
+    char buf[MB_LEN_MAX];
+
+    for (const Char c : s) {
+        const std::size_t n = std::wcrtomb(buf, c, &state);
+
+        if (n == static_cast<std::size_t>(-1)) {
+            return false;
+        }
+
+        res.append(buf, n);
+    }
+#elif defined(ARGS_QSTRING_BUILD)
+    res = QString(s.data(), static_cast<int>(s.size())).toLocal8Bit().toStdString();
+#else
+    res.assign(s.data(), s.size());
+#endif
+
+    return true;
+} // toLocal8Bit
+
+//
+// fromLocal8Bit
+//
+
+//! \return String decoded from the local 8-bit encoding, invalid bytes are taken as is.
+static inline String fromLocal8Bit(const char *data,
+                                   std::size_t size)
+{
+#ifdef ARGS_WSTRING_BUILD
+    std::mbstate_t state = std::mbstate_t();
+    String res;
+
+    res.reserve(size);
+
+    for (std::size_t i = 0; i < size;) {
+        wchar_t c = 0;
+        std::size_t n = std::mbrtowc(&c, data + i, size - i, &state);
+
+        if (n == static_cast<std::size_t>(-1) || n == static_cast<std::size_t>(-2)) {
+            c = static_cast<unsigned char>(data[i]);
+            n = 1;
+            state = std::mbstate_t();
+        } else if (n == 0) {
+            n = 1;
+        }
+
+        res.push_back(c);
+
+        i += n;
+    }
+
+    return res;
+#elif defined(ARGS_QSTRING_BUILD)
+    return String(QString::fromLocal8Bit(data, static_cast<int>(size)));
+#else
+    return String(data, size);
+#endif
+} // fromLocal8Bit
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__LOCAL_STRING_HPP__INCLUDED
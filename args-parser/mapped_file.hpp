@@ -0,0 +1,264 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__MAPPED_FILE_HPP__INCLUDED
+#define ARGS__MAPPED_FILE_HPP__INCLUDED
+
+// Args include.
+#include "local_string.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// MappedFile
+//
+
+/*!
+    Text file mapped into the memory privately, so the text can be
+    changed in place and only changed pages are copied.
+
+    In the builds with wide strings the text is decoded from the local
+    8-bit encoding, and in Windows the file is read.
+*/
+class MappedFile final
+{
+public:
+    MappedFile()
+        : m_data(nullptr)
+        , m_size(0)
+        , m_isMapped(false)
+        , m_begin(nullptr)
+        , m_end(nullptr)
+    {
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    /*!
+        Open the file with the given name.
+
+        \return false if the file can't be read.
+    */
+    bool open(const StringView &name)
+    {
+        unmap();
+
+        m_begin = nullptr;
+        m_end = nullptr;
+
+#if defined(ARGS_WSTRING_BUILD) || defined(ARGS_QSTRING_BUILD)
+        m_text.clear();
+#endif
+
+        std::string fileName;
+
+        if (!toLocal8Bit(name, fileName) || fileName.empty() || !map(fileName)) {
+            return false;
+        }
+
+#ifdef ARGS_WSTRING_BUILD
+        m_text = fromLocal8Bit(m_data, m_size);
+
+        unmap();
+
+        m_begin = &m_text[0];
+        m_end = m_begin + m_text.size();
+#elif defined(ARGS_QSTRING_BUILD)
+        m_text = QString::fromLocal8Bit(m_data, static_cast<int>(m_size));
+
+        unmap();
+
+        m_begin = m_text.data();
+        m_end = m_begin + m_text.size();
+#else
+        m_begin = m_data;
+        m_end = m_data + m_size;
+#endif
+
+        return true;
+    }
+
+    //! \return Identity of the file, the same for all names of the file.
+    const std::string &id() const
+    {
+        return m_id;
+    }
+
+    //! \return Begin of the text.
+    Char *begin() const
+    {
+        return m_begin;
+    }
+
+    //! \return End of the text.
+    Char *end() const
+    {
+        return m_end;
+    }
+
+private:
+    DISABLE_COPY(MappedFile)
+
+    //! Map the file into the memory.
+    bool map(const std::string &fileName)
+    {
+#ifdef _WIN32
+        std::FILE *file = std::fopen(fileName.c_str(), "rb");
+
+        if (!file) {
+            return false;
+        }
+
+        // Name isn't the identity of the file, i.e. "a.rsp" and ".\A.RSP" are the same file.
+        BY_HANDLE_FILE_INFORMATION info;
+        const HANDLE handle = reinterpret_cast<HANDLE>(::_get_osfhandle(::_fileno(file)));
+
+        if (handle == INVALID_HANDLE_VALUE || !::GetFileInformationByHandle(handle, &info)) {
+            std::fclose(file);
+
+            return false;
+        }
+
+        m_id = std::to_string(info.dwVolumeSerialNumber)
+            + ':'
+            + std::to_string(info.nFileIndexHigh)
+            + ':'
+            + std::to_string(info.nFileIndexLow);
+
+        char buf[4096];
+        std::size_t n = 0;
+
+        while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) {
+            m_buffer.insert(m_buffer.end(), buf, buf + n);
+        }
+
+        const bool isFailed = (std::ferror(file) != 0);
+
+        std::fclose(file);
+
+        if (isFailed) {
+            return false;
+        }
+
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#else
+        const int fd = ::open(fileName.c_str(), O_RDONLY);
+
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat st;
+
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+
+            return false;
+        }
+
+        m_id = std::to_string(st.st_dev) + ':' + std::to_string(st.st_ino);
+        m_size = static_cast<std::size_t>(st.st_size);
+
+        if (m_size) {
+            void *data = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            if (data == MAP_FAILED) {
+                ::close(fd);
+
+                return false;
+            }
+
+#ifdef MADV_SEQUENTIAL
+            ::madvise(data, m_size, MADV_SEQUENTIAL);
+#endif
+
+            m_data = static_cast<char *>(data);
+            m_isMapped = true;
+        }
+
+        ::close(fd);
+#endif
+
+        return true;
+    }
+
+    //! Unmap the file.
+    void unmap()
+    {
+#ifndef _WIN32
+        if (m_isMapped) {
+            ::munmap(m_data, m_size);
+        }
+#else
+        std::vector<char>().swap(m_buffer);
+#endif
+
+        m_data = nullptr;
+        m_size = 0;
+        m_isMapped = false;
+    }
+
+private:
+    //! Content of the file.
+    char *m_data;
+    //! Size of the file.
+    std::size_t m_size;
+    //! Is the file mapped?
+    bool m_isMapped;
+#ifdef _WIN32
+    //! Content of the file when it's read.
+    std::vector<char> m_buffer;
+#endif
+#ifdef ARGS_WSTRING_BUILD
+    //! Decoded content of the file.
+    String m_text;
+#elif defined(ARGS_QSTRING_BUILD)
+    //! Decoded content of the file.
+    QString m_text;
+#endif
+    //! Begin of the text.
+    Char *m_begin;
+    //! End of the text.
+    Char *m_end;
+    //! Identity of the file.
+    std::string m_id;
+}; // class MappedFile
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__MAPPED_FILE_HPP__INCLUDED
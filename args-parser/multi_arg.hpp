@@ -11,6 +11,7 @@
 #include "arg.hpp"
 #include "context.hpp"
 #include "exceptions.hpp"
+#include "parse_error.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 #include "value_utils.hpp"
@@ -80,6 +81,14 @@ public:
     //! \return All values for this argument.
     virtual const StringList &values() const;
 
+    /*!
+        \return All values for this argument moved out of it.
+
+        After that values() returns default values. If there are no
+        values, default values are copied.
+    */
+    StringList takeValues();
+
     /*!
         \return Count of times that this argument was presented
         in the command line if argument without value or count of values
@@ -215,6 +224,19 @@ inline const StringList &MultiArg::values() const
     }
 }
 
+inline StringList MultiArg::takeValues()
+{
+    if (!m_values.empty()) {
+        StringList tmp = std::move(m_values);
+
+        m_values.clear();
+
+        return tmp;
+    } else {
+        return m_defaultValues;
+    }
+}
+
 inline size_t MultiArg::count() const
 {
     if (!isWithValue()) {
@@ -229,10 +251,7 @@ inline size_t MultiArg::count() const
 inline void MultiArg::process(Context &context)
 {
     if (isWithValue()) {
-        setDefined(eatValues(context,
-                             m_values,
-                             String(SL("Argument \"")) + name() + SL("\" requires value that wasn't presented."),
-                             cmdLine()));
+        setDefined(eatValues(context, m_values, this, cmdLine()));
     } else {
         setDefined(true);
 
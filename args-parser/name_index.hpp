@@ -0,0 +1,334 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__NAME_INDEX_HPP__INCLUDED
+#define ARGS__NAME_INDEX_HPP__INCLUDED
+
+// Args include.
+#include "arg_iface.hpp"
+#include "enums.hpp"
+#include "group_iface.hpp"
+#include "name_trie.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// NameIndex
+//
+
+/*!
+    Open-addressing hash table that maps full names of the arguments,
+    i.e. "-t", "--timeout" or "add", to the arguments.
+
+    Flags from isCorrectFlag() set are kept in the direct table indexed
+    by the code of the character. Trie of the names for the resolution
+    of abbreviations is built on demand.
+*/
+class NameIndex final
+{
+public:
+    //! Size of the table of flags.
+    static const std::size_t c_flagsCount = 128;
+
+    NameIndex()
+        : m_size(0)
+        , m_flagsSize(0)
+        , m_otherFlagsSize(0)
+        , m_isTrieBuilt(false)
+    {
+        m_flags.fill(nullptr);
+    }
+
+    //! Remove all keys.
+    void clear()
+    {
+        m_slots.clear();
+        m_flags.fill(nullptr);
+        m_size = 0;
+        m_flagsSize = 0;
+        m_otherFlagsSize = 0;
+        m_trie.clear();
+        m_isTrieBuilt = false;
+    }
+
+    //! \return Count of keys in the index.
+    std::size_t size() const
+    {
+        return m_size + m_flagsSize;
+    }
+
+    /*!
+        Insert flag into the table of flags. Flag should be from
+        isCorrectFlag() set.
+
+        \return false if the flag is already in the index, in this case
+            the index isn't changed.
+    */
+    bool insertFlag(Char flag,
+                    ArgIface *arg)
+    {
+        ArgIface *&slot = m_flags[charCode(flag)];
+
+        if (slot) {
+            return false;
+        }
+
+        slot = arg;
+
+        ++m_flagsSize;
+
+        return true;
+    }
+
+    //! \return Argument for the given flag without leading dash or nullptr.
+    ArgIface *findFlag(Char flag) const
+    {
+        const std::size_t code = charCode(flag);
+
+        if (code < c_flagsCount && m_flags[code]) {
+            return m_flags[code];
+        }
+
+        if (m_otherFlagsSize) {
+            return findInTable(String(SL("-")) + String(1, flag));
+        }
+
+        return nullptr;
+    }
+
+    /*!
+        Insert key into the index.
+
+        \return false if the key is already in the index, in this case
+            the index isn't changed.
+    */
+    bool insert(const String &key,
+                ArgIface *arg)
+    {
+        if ((m_size + 1) * 2 > m_slots.size()) {
+            rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+        }
+
+        const std::size_t hash = hashString(key.begin(), key.end());
+
+        Slot &slot = m_slots[lookup(key, hash)];
+
+        if (slot.m_arg) {
+            return false;
+        }
+
+        slot.m_arg = arg;
+        slot.m_hash = hash;
+        slot.m_key = key;
+
+        ++m_size;
+
+        if (isFlag(key)) {
+            ++m_otherFlagsSize;
+        } else if (m_isTrieBuilt) {
+            m_trie.insert(key, arg);
+        }
+
+        return true;
+    }
+
+    //! \return Argument for the given key or nullptr.
+    ArgIface *find(const StringView &key) const
+    {
+        if (key.length() == 2 && key[0] == SL('-')) {
+            const std::size_t code = charCode(key[1]);
+
+            if (code < c_flagsCount && m_flags[code]) {
+                return m_flags[code];
+            }
+        }
+
+        return findInTable(key);
+    }
+
+    //! \return Trie of the names and of the commands, flags aren't in the trie.
+    const NameTrie &trie() const
+    {
+        if (!m_isTrieBuilt) {
+            for (const auto &slot : m_slots) {
+                if (slot.m_arg && !isFlag(slot.m_key)) {
+                    m_trie.insert(slot.m_key, slot.m_arg);
+                }
+            }
+
+            m_isTrieBuilt = true;
+        }
+
+        return m_trie;
+    }
+
+private:
+    //! \return Argument for the given key from the hash table or nullptr.
+    ArgIface *findInTable(const StringView &key) const
+    {
+        if (m_slots.empty()) {
+            return nullptr;
+        }
+
+        return m_slots[lookup(key, hashString(key.begin(), key.end()))].m_arg;
+    }
+
+    //! Slot of the hash table.
+    struct Slot {
+        Slot()
+            : m_arg(nullptr)
+            , m_hash(0)
+        {
+        }
+
+        //! Argument. nullptr if slot is empty.
+        ArgIface *m_arg;
+        //! Hash of the key.
+        std::size_t m_hash;
+        //! Key.
+        String m_key;
+    }; // struct Slot
+
+    //! \return Index of the slot with the given key or of the empty slot
+    //! where this key should be placed.
+    std::size_t lookup(const StringView &key,
+                       std::size_t hash) const
+    {
+        const std::size_t mask = m_slots.size() - 1;
+
+        std::size_t i = hash & mask;
+
+        while (m_slots[i].m_arg && (m_slots[i].m_hash != hash || m_slots[i].m_key != key)) {
+            i = (i + 1) & mask;
+        }
+
+        return i;
+    }
+
+    //! Rehash the table into the given count of slots.
+    void rehash(std::size_t capacity)
+    {
+        std::vector<Slot> old;
+        old.swap(m_slots);
+
+        m_slots.resize(capacity);
+
+        for (auto &slot : old) {
+            if (slot.m_arg) {
+                std::swap(m_slots[lookup(slot.m_key, slot.m_hash)], slot);
+            }
+        }
+    }
+
+private:
+    //! Slots.
+    std::vector<Slot> m_slots;
+    //! Table of flags.
+    std::array<ArgIface *, c_flagsCount> m_flags;
+    //! Count of keys in the hash table.
+    std::size_t m_size;
+    //! Count of flags in the table of flags.
+    std::size_t m_flagsSize;
+    //! Count of flags in the hash table, i.e. not from isCorrectFlag() set.
+    std::size_t m_otherFlagsSize;
+    //! Trie of the names.
+    mutable NameTrie m_trie;
+    //! Is trie built?
+    mutable bool m_isTrieBuilt;
+}; // class NameIndex
+
+//
+// indexArgument
+//
+
+/*!
+    Add all names of the argument to the index.
+
+    Groups are transparent, i.e. their children are added. Commands are
+    added by their names, children of commands are not added.
+*/
+static inline void indexArgument(NameIndex &index,
+                                 ArgIface *arg)
+{
+    switch (arg->type()) {
+    case ArgType::Command: {
+        index.insert(arg->name(), arg);
+    } break;
+
+    case ArgType::OnlyOneGroup:
+    case ArgType::AllOfGroup:
+    case ArgType::AtLeastOneGroup: {
+        for (const auto &ch : asConst(static_cast<GroupIface *>(arg)->children())) {
+            indexArgument(index, ch.get());
+        }
+    } break;
+
+    default: {
+        if (isCorrectFlag(arg->flag())) {
+            index.insertFlag(arg->flag()[0], arg);
+        } else if (!arg->flag().empty()) {
+            index.insert(String(SL("-")) + arg->flag(), arg);
+        }
+
+        if (!arg->argumentName().empty()) {
+            index.insert(String(SL("--")) + arg->argumentName(), arg);
+        }
+    } break;
+    }
+} // indexArgument
+
+//
+// indexTree
+//
+
+/*!
+    Add all names of the argument and of all its descendants to the
+    index, i.e. children of commands are added too.
+
+    \note Names from different scopes can clash, only the first
+        argument with the given name is kept.
+*/
+static inline void indexTree(NameIndex &index,
+                             ArgIface *arg)
+{
+    switch (arg->type()) {
+    case ArgType::Command: {
+        index.insert(arg->name(), arg);
+    }
+        // Fall through - to children.
+
+    case ArgType::OnlyOneGroup:
+    case ArgType::AllOfGroup:
+    case ArgType::AtLeastOneGroup: {
+        for (const auto &ch : asConst(static_cast<GroupIface *>(arg)->children())) {
+            indexTree(index, ch.get());
+        }
+    } break;
+
+    default: {
+        indexArgument(index, arg);
+    } break;
+    }
+} // indexTree
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__NAME_INDEX_HPP__INCLUDED
@@ -0,0 +1,279 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__NAME_TRIE_HPP__INCLUDED
+#define ARGS__NAME_TRIE_HPP__INCLUDED
+
+// Args include.
+#include "arg_iface.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// NameTrie
+//
+
+/*!
+    Radix trie of the names of the arguments, i.e. "--timeout" or "add".
+
+    Every node knows count of the keys in its subtree, so resolution
+    of the prefix costs O(length of the prefix). Children are sorted by
+    their first character, so keys are walked in the lexicographical
+    order.
+*/
+class NameTrie final
+{
+public:
+    NameTrie()
+    {
+        clear();
+    }
+
+    //! Remove all keys.
+    void clear()
+    {
+        m_nodes.clear();
+        m_nodes.push_back(Node());
+    }
+
+    /*!
+        Insert key into the trie.
+
+        \return false if the key is already in the trie, in this case
+            the trie isn't changed.
+    */
+    bool insert(const String &key,
+                ArgIface *arg)
+    {
+        if (key.empty()) {
+            return false;
+        }
+
+        std::vector<std::size_t> path(1, 0);
+        std::size_t node = 0;
+        String::size_type pos = 0;
+
+        while (pos < key.length()) {
+            const auto it = findChild(node, key[pos]);
+
+            if (it == m_nodes[node].m_children.cend() || !(m_nodes[*it].m_label[0] == key[pos])) {
+                const std::size_t leaf = m_nodes.size();
+
+                Node n;
+                n.m_label = key.substr(pos);
+
+                m_nodes[node].m_children.insert(it, leaf);
+                m_nodes.push_back(n);
+                path.push_back(leaf);
+
+                pos = key.length();
+                node = leaf;
+
+                break;
+            }
+
+            const std::size_t child = *it;
+            const String::size_type common = commonLength(m_nodes[child].m_label, key, pos);
+
+            if (common < m_nodes[child].m_label.length()) {
+                // Split the edge.
+                const std::size_t middle = m_nodes.size();
+
+                Node n;
+                n.m_label = m_nodes[child].m_label.substr(0, common);
+                n.m_count = m_nodes[child].m_count;
+                n.m_children.push_back(child);
+
+                m_nodes[child].m_label = m_nodes[child].m_label.substr(common);
+                m_nodes[node].m_children[it - m_nodes[node].m_children.cbegin()] = middle;
+                m_nodes.push_back(n);
+
+                node = middle;
+            } else {
+                node = child;
+            }
+
+            pos += common;
+            path.push_back(node);
+        }
+
+        if (m_nodes[node].m_arg) {
+            return false;
+        }
+
+        m_nodes[node].m_arg = arg;
+
+        for (const auto &n : path) {
+            ++m_nodes[n].m_count;
+        }
+
+        return true;
+    }
+
+    /*!
+        \return Count of the keys starting with the given prefix.
+
+        \a arg is set to the argument if there is exactly one such key.
+    */
+    std::size_t find(const StringView &prefix,
+                     ArgIface *&arg) const
+    {
+        arg = nullptr;
+
+        const std::size_t node = locate(prefix, nullptr);
+
+        if (node == c_noNode) {
+            return 0;
+        }
+
+        if (m_nodes[node].m_count == 1) {
+            arg = m_nodes[node].m_arg;
+        }
+
+        return m_nodes[node].m_count;
+    }
+
+    //! Append to \a keys all keys starting with the given prefix in the lexicographical order.
+    void collect(const String &prefix,
+                 StringList &keys) const
+    {
+        String key;
+
+        const std::size_t node = locate(prefix, &key);
+
+        if (node != c_noNode) {
+            collect(node, key, keys);
+        }
+    }
+
+private:
+    //! Index of absent node.
+    static const std::size_t c_noNode = static_cast<std::size_t>(-1);
+
+    //! Node of the trie.
+    struct Node {
+        Node()
+            : m_arg(nullptr)
+            , m_count(0)
+        {
+        }
+
+        //! Label of the edge from parent.
+        String m_label;
+        //! Children sorted by the first character of the label.
+        std::vector<std::size_t> m_children;
+        //! Argument if the key ends in this node.
+        ArgIface *m_arg;
+        //! Count of the keys in the subtree.
+        std::size_t m_count;
+    }; // struct Node
+
+    //! \return Child of the node with the label starting with the given
+    //! character or position where such child should be inserted.
+    std::vector<std::size_t>::const_iterator findChild(std::size_t node,
+                                                       Char c) const
+    {
+        const auto &children = m_nodes[node].m_children;
+
+        return std::lower_bound(children.cbegin(),
+                                children.cend(),
+                                charCode(c),
+                                [this](std::size_t n, std::size_t code) {
+                                    return charCode(m_nodes[n].m_label[0]) < code;
+                                });
+    }
+
+    //! \return Length of the common prefix of the label and the key from the given position.
+    static String::size_type commonLength(const String &label,
+                                          const StringView &key,
+                                          String::size_type pos)
+    {
+        String::size_type i = 0;
+
+        while (i < label.length() && pos + i < key.length() && label[i] == key[pos + i]) {
+            ++i;
+        }
+
+        return i;
+    }
+
+    /*!
+        \return Node with the subtree of all keys starting with the
+            given prefix or c_noNode.
+
+        \a key, if not null, is set to the key of the found node.
+    */
+    std::size_t locate(const StringView &prefix,
+                       String *key) const
+    {
+        std::size_t node = 0;
+        String::size_type pos = 0;
+
+        while (pos < prefix.length()) {
+            const auto it = findChild(node, prefix[pos]);
+
+            if (it == m_nodes[node].m_children.cend() || !(m_nodes[*it].m_label[0] == prefix[pos])) {
+                return c_noNode;
+            }
+
+            const String &label = m_nodes[*it].m_label;
+            const String::size_type common = commonLength(label, prefix, pos);
+
+            if (common < label.length() && pos + common < prefix.length()) {
+                return c_noNode;
+            }
+
+            if (key) {
+                key->append(label);
+            }
+
+            node = *it;
+            pos += common;
+        }
+
+        if (!m_nodes[node].m_count) {
+            return c_noNode;
+        }
+
+        return node;
+    }
+
+    //! Append all keys of the subtree.
+    void collect(std::size_t node,
+                 const String &key,
+                 StringList &keys) const
+    {
+        if (m_nodes[node].m_arg) {
+            keys.push_back(key);
+        }
+
+        for (const auto &child : m_nodes[node].m_children) {
+            collect(child, key + m_nodes[child].m_label, keys);
+        }
+    }
+
+private:
+    //! Nodes. First one is the root.
+    std::vector<Node> m_nodes;
+}; // class NameTrie
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__NAME_TRIE_HPP__INCLUDED
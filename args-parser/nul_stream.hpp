@@ -0,0 +1,237 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__NUL_STREAM_HPP__INCLUDED
+#define ARGS__NUL_STREAM_HPP__INCLUDED
+
+// Args include.
+#include "context.hpp"
+#include "local_string.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// NulStream
+//
+
+/*!
+    Stream of words separated with NUL characters read from the file
+    descriptor, i.e. output of "find -print0" or "xargs -0" input.
+
+    File descriptor is read with chunks, words are views to the chunks,
+    so they aren't copied, only the word cut by the end of the chunk is
+    moved to the next chunk. Chunks are released when their words are
+    processed, so memory doesn't depend on the size of the stream.
+*/
+class NulStream final
+{
+public:
+    //! Default size of the chunk.
+    enum : std::size_t { c_chunkSize = 64 * 1024 };
+    //! Count of the words read ahead of the parsed word.
+    enum : std::size_t { c_lookAhead = 1024 };
+
+    explicit NulStream(
+        //! File descriptor, it isn't closed.
+        int fd,
+        //! Size of the chunk.
+        std::size_t chunkSize = c_chunkSize)
+        : m_fd(fd)
+        , m_chunkSize(chunkSize ? chunkSize : 1)
+        , m_isEnd(false)
+        , m_isFailed(false)
+        , m_count(0)
+    {
+    }
+
+    /*!
+        Read next chunk and append its words to \a words.
+
+        \return false if there are no more words, i.e. at the end of
+            the stream or on the error of reading.
+    */
+    bool read(ContextView &words)
+    {
+        if (m_isEnd) {
+            return false;
+        }
+
+        Chunk chunk;
+        std::vector<char> &data = chunk.m_data;
+
+        data.swap(m_partial);
+
+        std::size_t size = data.size();
+
+        for (;;) {
+            data.resize(size + m_chunkSize);
+
+            const auto n = readSome(data.data() + size, m_chunkSize);
+
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                m_isEnd = true;
+                m_isFailed = true;
+
+                return false;
+            }
+
+            if (n == 0) {
+                m_isEnd = true;
+
+                break;
+            }
+
+            const std::size_t first = size;
+
+            size += static_cast<std::size_t>(n);
+
+            // Chunk should have at least one word.
+            if (std::memchr(data.data() + first, '\0', size - first)) {
+                break;
+            }
+        }
+
+        data.resize(size);
+
+        if (!m_isEnd) {
+            std::size_t last = size;
+
+            while (data[last - 1] != '\0') {
+                --last;
+            }
+
+            m_partial.assign(data.cbegin() + static_cast<std::ptrdiff_t>(last), data.cend());
+            data.resize(last);
+        } else if (size) {
+            // Last word may be without NUL.
+            data.push_back('\0');
+        }
+
+        if (data.empty()) {
+            return false;
+        }
+
+        m_chunks.push_back(std::move(chunk));
+
+        Chunk &added = m_chunks.back();
+
+        for (const char *word = added.m_data.data(), *end = word + added.m_data.size(); word != end;) {
+            const std::size_t length = std::strlen(word);
+
+#if defined(ARGS_WSTRING_BUILD) || defined(ARGS_QSTRING_BUILD)
+            added.m_words.push_back(fromLocal8Bit(word, length));
+            words.push_back(added.m_words.back());
+#else
+            words.push_back(StringView(word, length));
+#endif
+
+            word += length + 1;
+
+            ++m_count;
+        }
+
+        added.m_end = m_count;
+
+        return true;
+    }
+
+    //! \return Is the stream read to the end?
+    bool atEnd() const
+    {
+        return m_isEnd;
+    }
+
+    //! \return Was reading failed?
+    bool isFailed() const
+    {
+        return m_isFailed;
+    }
+
+    //! Release chunks with the words before the given index of the word.
+    void release(std::size_t index)
+    {
+        while (!m_chunks.empty() && m_chunks.front().m_end <= index) {
+            m_chunks.pop_front();
+        }
+    }
+
+private:
+    DISABLE_COPY(NulStream)
+
+    //! Read from the file descriptor. \return Count of read bytes, 0 at the end or -1 on error.
+    long readSome(char *buf,
+                  std::size_t size)
+    {
+#ifdef _WIN32
+        return ::_read(m_fd, buf, static_cast<unsigned int>(size));
+#else
+        return static_cast<long>(::read(m_fd, buf, size));
+#endif
+    }
+
+    //! Chunk of the stream.
+    struct Chunk {
+        Chunk()
+            : m_end(0)
+        {
+        }
+
+        //! Words with NUL at the end of each.
+        std::vector<char> m_data;
+#if defined(ARGS_WSTRING_BUILD) || defined(ARGS_QSTRING_BUILD)
+        //! Decoded words, deque keeps them in place.
+        std::deque<String> m_words;
+#endif
+        //! Index of the word after the last word of the chunk.
+        std::size_t m_end;
+    }; // struct Chunk
+
+private:
+    //! File descriptor.
+    int m_fd;
+    //! Size of the chunk.
+    std::size_t m_chunkSize;
+    //! Is the stream read to the end?
+    bool m_isEnd;
+    //! Was reading failed?
+    bool m_isFailed;
+    //! Chunks with not processed words.
+    std::deque<Chunk> m_chunks;
+    //! Beginning of the word cut by the end of the last chunk.
+    std::vector<char> m_partial;
+    //! Count of read words.
+    std::size_t m_count;
+}; // class NulStream
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__NUL_STREAM_HPP__INCLUDED
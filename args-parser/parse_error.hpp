@@ -0,0 +1,247 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__PARSE_ERROR_HPP__INCLUDED
+#define ARGS__PARSE_ERROR_HPP__INCLUDED
+
+// Args include.
+#include "enums.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <utility>
+
+namespace Args
+{
+
+class ArgIface;
+class CmdLine;
+class StaticArg;
+
+template<std::size_t N>
+class StaticSchema;
+
+namespace details
+{
+
+struct ParseState;
+
+} /* namespace details */
+
+//
+// ParseError
+//
+
+/*!
+    Result of the parsing, i.e. code of the error, index of the
+    offending word and involved arguments.
+
+    Message is formatted only on request.
+
+    \note Word and arguments are not copied, so the error is valid
+        while CmdLine and parsed words are alive and CmdLine is not
+        parsed again. Error from ParseResult is valid while the
+        result is alive.
+*/
+class ParseError final
+{
+public:
+    //! Index of the word for errors not bound to the word.
+    enum : std::size_t { c_noToken = static_cast<std::size_t>(-1) };
+    //! Index of the argument of StaticSchema for errors not about such argument.
+    enum : std::size_t { c_noArgument = static_cast<std::size_t>(-1) };
+
+    ParseError()
+        : m_code(ParseErrorCode::NoError)
+        , m_tokenIndex(c_noToken)
+        , m_arg(nullptr)
+        , m_otherArg(nullptr)
+        , m_group(nullptr)
+        , m_cmdLine(nullptr)
+        , m_state(nullptr)
+        , m_staticArg(nullptr)
+        , m_argumentIndex(c_noArgument)
+    {
+    }
+
+    explicit ParseError(ParseErrorCode code,
+                        const ArgIface *arg = nullptr,
+                        const ArgIface *otherArg = nullptr,
+                        const ArgIface *group = nullptr)
+        : m_code(code)
+        , m_tokenIndex(c_noToken)
+        , m_arg(arg)
+        , m_otherArg(otherArg)
+        , m_group(group)
+        , m_cmdLine(nullptr)
+        , m_state(nullptr)
+        , m_staticArg(nullptr)
+        , m_argumentIndex(c_noArgument)
+    {
+    }
+
+    //! Error with already formatted message.
+    explicit ParseError(String message,
+                        const ArgIface *arg = nullptr)
+        : m_code(ParseErrorCode::Other)
+        , m_tokenIndex(c_noToken)
+        , m_arg(arg)
+        , m_otherArg(nullptr)
+        , m_group(nullptr)
+        , m_cmdLine(nullptr)
+        , m_state(nullptr)
+        , m_staticArg(nullptr)
+        , m_argumentIndex(c_noArgument)
+        , m_message(std::move(message))
+    {
+    }
+
+    //! \return Error of the value that can't be converted to the type of the argument.
+    static ParseError invalidValue(const ArgIface *arg,
+                                   String value)
+    {
+        ParseError error(ParseErrorCode::InvalidValue, arg);
+        error.m_message = std::move(value);
+
+        return error;
+    }
+
+    //! \return Error of the response file that includes itself.
+    static ParseError recursiveResponseFile(String fileName)
+    {
+        ParseError error(ParseErrorCode::RecursiveResponseFile);
+        error.m_message = std::move(fileName);
+
+        return error;
+    }
+
+    //! \return Error of the key of the config file that isn't a name of an argument.
+    static ParseError unknownConfigKey(String key)
+    {
+        ParseError error(ParseErrorCode::UnknownConfigKey);
+        error.m_message = std::move(key);
+
+        return error;
+    }
+
+    //! \return Is there an error?
+    explicit operator bool() const
+    {
+        return (m_code != ParseErrorCode::NoError);
+    }
+
+    //! \return Code of the error.
+    ParseErrorCode code() const
+    {
+        return m_code;
+    }
+
+    /*!
+        \return Index of the offending word, i.e. argv[index + 1],
+            or c_noToken.
+    */
+    std::size_t tokenIndex() const
+    {
+        return m_tokenIndex;
+    }
+
+    //! \return Offending part of the word, i.e. "--name" of "--name=value".
+    String word() const
+    {
+        return m_word.toString();
+    }
+
+    //! \return Argument the error is about.
+    const ArgIface *argument() const
+    {
+        return m_arg;
+    }
+
+    //! \return Second argument involved, i.e. already defined command.
+    const ArgIface *otherArgument() const
+    {
+        return m_otherArg;
+    }
+
+    //! \return Group which constraint is violated.
+    const ArgIface *group() const
+    {
+        return m_group;
+    }
+
+    //! \return Argument of StaticSchema the error is about.
+    const StaticArg *staticArgument() const
+    {
+        return m_staticArg;
+    }
+
+    //! \return Index of the argument of StaticSchema the error is about or c_noArgument.
+    std::size_t argumentIndex() const
+    {
+        return m_argumentIndex;
+    }
+
+    //! \return Human readable message.
+    String message() const;
+
+private:
+    //! \return Name of the argument the error is about.
+    String argumentName() const;
+
+private:
+    friend class CmdLine;
+    friend class ParseResult;
+
+    template<std::size_t N>
+    friend class StaticSchema;
+
+    //! Code.
+    ParseErrorCode m_code;
+    //! Index of the word.
+    std::size_t m_tokenIndex;
+    //! Offending part of the word.
+    details::StringView m_word;
+    //! Argument.
+    const ArgIface *m_arg;
+    //! Second argument.
+    const ArgIface *m_otherArg;
+    //! Group.
+    const ArgIface *m_group;
+    //! Parser, used for hints in the message.
+    const CmdLine *m_cmdLine;
+    //! State of the parsing, i.e. active commands, used for hints in the message.
+    const details::ParseState *m_state;
+    //! Argument of StaticSchema.
+    const StaticArg *m_staticArg;
+    //! Index of the argument of StaticSchema.
+    std::size_t m_argumentIndex;
+    //! Message of ParseErrorCode::Other error, value of ParseErrorCode::InvalidValue
+    //! error, file of ParseErrorCode::RecursiveResponseFile error or key of
+    //! ParseErrorCode::UnknownConfigKey error.
+    String m_message;
+}; // class ParseError
+
+namespace details
+{
+
+/*!
+    Report error of the parsing to the parser. Parser either throws
+    exception or keeps the error and stops parsing. Index of the word
+    is set by the parser.
+
+    Code reporting the error should return without throwing. Only the
+    first reported error is kept.
+*/
+inline void reportError(CmdLine *cmdLine,
+                        ParseError error);
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__PARSE_ERROR_HPP__INCLUDED
@@ -0,0 +1,75 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__PARSE_HANDLER_IFACE_HPP__INCLUDED
+#define ARGS__PARSE_HANDLER_IFACE_HPP__INCLUDED
+
+// Args include.
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace Args
+{
+
+class ArgIface;
+class Command;
+
+//
+// ParseHandlerIface
+//
+
+/*!
+    Interface for the receiver of the events of the parsing with
+    CmdLine::parseToHandler().
+
+    Events come in the order of the words in the command line. Values
+    and positional arguments are passed only to the handler, they are
+    not kept anywhere. Each event does nothing by default.
+*/
+class ParseHandlerIface
+{
+public:
+    ParseHandlerIface()
+    {
+    }
+
+    virtual ~ParseHandlerIface()
+    {
+    }
+
+    //! Argument is found, its values follow.
+    virtual void argument(const ArgIface &arg)
+    {
+        UNUSED(arg)
+    }
+
+    //! Command is entered, its values and arguments follow.
+    virtual void command(const Command &cmd)
+    {
+        UNUSED(cmd)
+    }
+
+    //! Value of the last found argument or command.
+    virtual void value(const ArgIface &arg,
+                       const String &value)
+    {
+        UNUSED(arg)
+        UNUSED(value)
+    }
+
+    //! Positional argument.
+    virtual void positional(const String &word)
+    {
+        UNUSED(word)
+    }
+
+private:
+    DISABLE_COPY(ParseHandlerIface)
+}; // class ParseHandlerIface
+
+} /* namespace Args */
+
+#endif // ARGS__PARSE_HANDLER_IFACE_HPP__INCLUDED
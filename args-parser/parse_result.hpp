@@ -0,0 +1,248 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__PARSE_RESULT_HPP__INCLUDED
+#define ARGS__PARSE_RESULT_HPP__INCLUDED
+
+// Args include.
+#include "config_file.hpp"
+#include "context.hpp"
+#include "parse_error.hpp"
+#include "response_file.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "values_view.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Args
+{
+
+class ArgIface;
+class CmdLine;
+class Command;
+
+//
+// Occurrence
+//
+
+//! Occurrence of the argument in the command line.
+struct Occurrence {
+    //! Argument.
+    ArgIface *m_arg;
+    //! Index of the word, i.e. argv[index + 1].
+    std::size_t m_tokenIndex;
+}; // struct Occurrence
+
+namespace details
+{
+
+class ResultSink;
+
+//
+// ParseState
+//
+
+//! State of one parsing, i.e. active commands and error.
+struct ParseState {
+    ParseState()
+        : m_command(nullptr)
+        , m_currCommand(nullptr)
+        , m_tokenIndex(ParseError::c_noToken)
+        , m_isPositional(false)
+    {
+    }
+
+    //! Reset state before parsing.
+    void clear()
+    {
+        m_command = nullptr;
+        m_currCommand = nullptr;
+        m_prevCommand.clear();
+        m_tokenIndex = ParseError::c_noToken;
+        m_isPositional = false;
+        m_word = StringView();
+        m_error = ParseError();
+        m_occurrences.clear();
+    }
+
+    //! Current top command.
+    Command *m_command;
+    //! Current command.
+    Command *m_currCommand;
+    //! Active commands from the top one.
+    std::vector<Command *> m_prevCommand;
+    //! Index of the word being processed.
+    std::size_t m_tokenIndex;
+    //! Are the rest words positional arguments?
+    bool m_isPositional;
+    //! Name part of the word being processed.
+    StringView m_word;
+    //! First error.
+    ParseError m_error;
+    //! Processed arguments in the order of the occurrence.
+    std::vector<Occurrence> m_occurrences;
+}; // struct ParseState
+
+//
+// ParsedArg
+//
+
+//! Parsed state of one argument.
+struct ParsedArg {
+    ParsedArg()
+        : m_isDefined(false)
+        , m_count(0)
+        , m_subCommand(nullptr)
+    {
+    }
+
+    //! Is argument defined?
+    bool m_isDefined;
+    //! Count of times the argument without value was presented.
+    std::size_t m_count;
+    //! Values.
+    StringList m_values;
+    //! Sub-command of the command.
+    const Command *m_subCommand;
+}; // struct ParsedArg
+
+//
+// ParsedArgUndo
+//
+
+//! Parsed state of the argument before the change, to undo the change.
+struct ParsedArgUndo {
+    //! Changed parsed state.
+    ParsedArg *m_parsed;
+    //! Was argument defined?
+    bool m_isDefined;
+    //! Count.
+    std::size_t m_count;
+    //! Count of values.
+    std::size_t m_valuesCount;
+    //! Sub-command.
+    const Command *m_subCommand;
+}; // struct ParsedArgUndo
+
+} /* namespace details */
+
+//
+// ParseResult
+//
+
+/*!
+    Result of parsing with CmdLine::parseToResult().
+
+    Arguments aren't changed by such parsing, everything parsed is
+    here, indexed by the arguments.
+
+    \note Result refers to the arguments and to the parsed words, so
+        they should outlive the result.
+*/
+class ParseResult final
+{
+public:
+    ParseResult()
+        : m_cmdLine(nullptr)
+    {
+    }
+
+    //! \return Error of the parsing, it's false on success.
+    ParseError error() const;
+
+    //! \return Is the argument defined?
+    //! \note Group is defined by its rule, i.e. all children for AllOf group.
+    bool isDefined(const ArgIface &arg) const;
+
+    //! \return Is argument defined?
+    bool isDefined(
+        //! Name of the argument. Should be full name, i.e '-a' or '--arg'
+        //! or 'add' if it's a command or subcommand.
+        const String &name) const;
+
+    //! \return Value of the argument or its default value.
+    const String &value(const ArgIface &arg) const;
+
+    //! \return Value of the argument.
+    const String &value(
+        //! Name of the argument. Should be full name, i.e '-a' or '--arg'
+        //! or 'add' if it's a command or subcommand.
+        const String &name) const;
+
+    //! \return View to the values of the argument or to its default values.
+    ValuesView values(const ArgIface &arg) const;
+
+    //! \return View to the values of the argument.
+    ValuesView values(
+        //! Name of the argument. Should be full name, i.e '-a' or '--arg'
+        //! or 'add' if it's a command or subcommand.
+        const String &name) const;
+
+    /*!
+        \return Count of times that the argument without value was
+            presented in the command line or count of values.
+    */
+    std::size_t count(const ArgIface &arg) const;
+
+    //! \return Top level command or nullptr.
+    const Command *command() const
+    {
+        return m_state.m_command;
+    }
+
+    //! \return Sub-command of the command or nullptr.
+    const Command *subCommand(const Command &cmd) const;
+
+    //! \return Positional arguments.
+    const StringList &positional() const
+    {
+        return m_positional;
+    }
+
+    /*!
+        \return Processed arguments in the order of the occurrence.
+        Argument is here as many times as it was met.
+    */
+    const std::vector<Occurrence> &occurrences() const
+    {
+        return m_state.m_occurrences;
+    }
+
+private:
+    //! \return Parsed state of the argument or nullptr if it's not from the parser.
+    const details::ParsedArg *parsed(const ArgIface &arg) const;
+
+    //! \return Parsed state of the argument or nullptr if it's not from the parser.
+    details::ParsedArg *parsed(const ArgIface &arg);
+
+private:
+    friend class CmdLine;
+    friend class Repl;
+    friend class details::ResultSink;
+
+    //! Parser.
+    const CmdLine *m_cmdLine;
+    //! State of the parsing.
+    details::ParseState m_state;
+    //! Parsed arguments, indexed by the ids of the arguments.
+    std::vector<details::ParsedArg> m_args;
+    //! Positional arguments.
+    StringList m_positional;
+    //! Owned words, when they can't be viewed in place.
+    ContextInternal m_words;
+    //! Response files parsed words refer to.
+    details::ResponseFiles m_responseFiles;
+    //! Config file parsed keys refer to.
+    std::shared_ptr<const details::ConfigFile> m_configFile;
+}; // class ParseResult
+
+} /* namespace Args */
+
+#endif // ARGS__PARSE_RESULT_HPP__INCLUDED
@@ -0,0 +1,129 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__POSITIONAL_QUEUE_HPP__INCLUDED
+#define ARGS__POSITIONAL_QUEUE_HPP__INCLUDED
+
+// Args include.
+#include "positional_sink_iface.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace Args
+{
+
+//
+// PositionalQueue
+//
+
+/*!
+    Bounded queue of positional arguments between the parsing thread
+    and consumer threads.
+
+    Parsing waits while the queue is full, consumers wait while the
+    queue is empty, so memory doesn't depend on the count of positional
+    arguments. Queue should be closed when the parsing is done, even
+    with an error, then consumers take the rest and stop.
+*/
+class PositionalQueue final : public PositionalSinkIface
+{
+public:
+    explicit PositionalQueue(
+        //! Maximum count of words in the queue.
+        std::size_t capacity = 1024)
+        : m_capacity(capacity ? capacity : 1)
+        , m_isClosed(false)
+    {
+    }
+
+    //! Put the word into the queue, wait while the queue is full.
+    //! \note Word is dropped if the queue is closed.
+    void positional(String &&word) override
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_notFull.wait(lock, [this] {
+            return (m_words.size() < m_capacity || m_isClosed);
+        });
+
+        if (m_isClosed) {
+            return;
+        }
+
+        m_words.push_back(std::move(word));
+
+        lock.unlock();
+
+        m_notEmpty.notify_one();
+    }
+
+    /*!
+        Take the word from the queue, wait while the queue is empty.
+
+        \return false if the queue is closed and empty.
+    */
+    bool pop(String &word)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_notEmpty.wait(lock, [this] {
+            return (!m_words.empty() || m_isClosed);
+        });
+
+        if (m_words.empty()) {
+            return false;
+        }
+
+        word = std::move(m_words.front());
+        m_words.pop_front();
+
+        lock.unlock();
+
+        m_notFull.notify_one();
+
+        return true;
+    }
+
+    //! Close the queue, no more words will be put.
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_isClosed = true;
+        }
+
+        m_notEmpty.notify_all();
+        m_notFull.notify_all();
+    }
+
+private:
+    DISABLE_COPY(PositionalQueue)
+
+    //! Maximum count of words.
+    const std::size_t m_capacity;
+    //! Words.
+    std::deque<String> m_words;
+    //! Is the queue closed?
+    bool m_isClosed;
+    //! Mutex.
+    std::mutex m_mutex;
+    //! Signaled when a word is put.
+    std::condition_variable m_notEmpty;
+    //! Signaled when a word is taken or the queue is closed.
+    std::condition_variable m_notFull;
+}; // class PositionalQueue
+
+} /* namespace Args */
+
+#endif // ARGS__POSITIONAL_QUEUE_HPP__INCLUDED
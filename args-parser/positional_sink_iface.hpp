@@ -0,0 +1,48 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__POSITIONAL_SINK_IFACE_HPP__INCLUDED
+#define ARGS__POSITIONAL_SINK_IFACE_HPP__INCLUDED
+
+// Args include.
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace Args
+{
+
+//
+// PositionalSinkIface
+//
+
+/*!
+    Interface for the receiver of positional arguments.
+
+    CmdLine with the sink passes positional arguments to the sink one
+    by one as they are found instead of keeping them in positional(),
+    so the application can handle them before the parsing finishes.
+*/
+class PositionalSinkIface
+{
+public:
+    PositionalSinkIface()
+    {
+    }
+
+    virtual ~PositionalSinkIface()
+    {
+    }
+
+    //! Handle positional argument.
+    virtual void positional(String &&word) = 0;
+
+private:
+    DISABLE_COPY(PositionalSinkIface)
+}; // class PositionalSinkIface
+
+} /* namespace Args */
+
+#endif // ARGS__POSITIONAL_SINK_IFACE_HPP__INCLUDED
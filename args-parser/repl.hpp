@@ -0,0 +1,292 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__REPL_HPP__INCLUDED
+#define ARGS__REPL_HPP__INCLUDED
+
+// Args include.
+#include "cmd_line.hpp"
+#include "context.hpp"
+#include "exceptions.hpp"
+#include "parse_result.hpp"
+#include "types.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+namespace Args
+{
+
+//
+// Repl
+//
+
+/*!
+    Interactive parsing of the line that is edited word by word.
+
+    Repl keeps words, classified context and state of the previous
+    parsing, on update only words starting from the first changed one
+    are copied, classified and parsed again. Arguments aren't changed,
+    parsed values are in result().
+
+    \note CmdLine should be frozen with CmdLine::freeze() and should
+        outlive Repl.
+*/
+class Repl final
+{
+public:
+    explicit Repl(const CmdLine &cmdLine)
+        : m_cmdLine(cmdLine)
+        , m_generation(0)
+        , m_reparsedFrom(0)
+    {
+    }
+
+    /*!
+        Set words of the line, i.e. the line without the executable name.
+
+        \return Result of the parsing.
+
+        \throw BaseException if CmdLine is not frozen.
+    */
+    const ParseResult &update(const StringList &words);
+
+    //! \return Result of the last parsing.
+    const ParseResult &result() const
+    {
+        return m_result;
+    }
+
+    //! \return Index of the first word parsed with the last update().
+    std::size_t reparsedFrom() const
+    {
+        return m_reparsedFrom;
+    }
+
+    /*!
+        \return Names of the arguments and commands starting with the
+            given prefix, visible in the scope of the active commands.
+
+        \note Tries of the names are built on the first use if
+            CmdLine::AllowAbbreviations is not set, so with such CmdLine
+            complete() shouldn't be invoked simultaneously from different
+            threads.
+    */
+    StringList complete(const String &prefix) const
+    {
+        StringList names;
+
+        m_cmdLine.collectAbbreviations(prefix, names, m_result.m_state);
+
+        return names;
+    }
+
+private:
+    //! State of the parsing before the word.
+    struct Checkpoint {
+        //! Index of the word.
+        std::ptrdiff_t m_pos;
+        //! Count of the changes of parsed state.
+        std::size_t m_undoCount;
+        //! Count of the occurrences.
+        std::size_t m_occurrencesCount;
+        //! Count of the positional arguments.
+        std::size_t m_positionalCount;
+        //! Count of the active commands.
+        std::size_t m_commandsCount;
+        //! Are the rest words positional arguments?
+        bool m_isPositional;
+        //! Can parsing be continued from here?
+        bool m_isResumable;
+    }; // struct Checkpoint
+
+    //! Start parsing from the scratch.
+    void reset();
+
+    //! Undo parsing to the given checkpoint.
+    void rollback(std::size_t checkpoint);
+
+private:
+    DISABLE_COPY(Repl)
+
+    //! Parser.
+    const CmdLine &m_cmdLine;
+    //! Generation of the arguments the result is for.
+    std::size_t m_generation;
+    //! Words, context refers to them, so they aren't moved on changes.
+    std::deque<String> m_words;
+    //! Classified context over the words.
+    Context m_context;
+    //! Result.
+    ParseResult m_result;
+    //! Changes of parsed state.
+    std::vector<details::ParsedArgUndo> m_undo;
+    //! States before the parsed words.
+    std::vector<Checkpoint> m_checkpoints;
+    //! Index of the first word parsed with the last update().
+    std::size_t m_reparsedFrom;
+}; // class Repl
+
+//
+// Repl
+//
+
+inline const ParseResult &Repl::update(const StringList &words)
+{
+    if (!m_cmdLine.isFrozen()) {
+        ARGS_THROW(BaseException(
+            String(SL("Command line parser should be frozen "
+                      "before parsing to the result."))));
+    }
+
+    std::size_t changed = 0;
+
+    if (m_generation != m_cmdLine.m_frozenGeneration || m_result.m_cmdLine != &m_cmdLine) {
+        reset();
+    } else {
+        auto it = m_words.cbegin();
+        auto nit = words.cbegin();
+
+        for (; it != m_words.cend() && nit != words.cend() && *it == *nit; ++it, ++nit) {
+            ++changed;
+        }
+
+        if (it == m_words.cend() && nit == words.cend()) {
+            m_reparsedFrom = changed;
+
+            return m_result;
+        }
+    }
+
+    // Step is kept only if it ended before the changed word, as the
+    // word after the step could be looked at by the step.
+    std::size_t checkpoint = 0;
+
+    for (std::size_t i = m_checkpoints.size(); i > 0; --i) {
+        if (m_checkpoints[i - 1].m_isResumable && m_checkpoints[i - 1].m_pos < static_cast<std::ptrdiff_t>(changed)) {
+            checkpoint = i - 1;
+
+            break;
+        }
+    }
+
+    rollback(checkpoint);
+
+    m_reparsedFrom = (m_checkpoints.empty() ? 0 : static_cast<std::size_t>(m_checkpoints.back().m_pos));
+
+    m_words.erase(std::next(m_words.begin(), static_cast<std::ptrdiff_t>(changed)), m_words.end());
+    m_words.insert(m_words.end(), std::next(words.cbegin(), static_cast<std::ptrdiff_t>(changed)), words.cend());
+
+    // Words from the checkpoint are viewed again, as the parsed steps
+    // could change them in the context, i.e. "--name=value" is split.
+    ContextView views;
+    views.reserve(m_words.size() - m_reparsedFrom);
+
+    for (std::size_t i = m_reparsedFrom; i < m_words.size(); ++i) {
+        views.push_back(m_words[i]);
+    }
+
+    m_context.replace(m_reparsedFrom, views, [this](const details::StringView &word, String::size_type splitOffset) {
+        return m_cmdLine.classifyWord(word, splitOffset);
+    });
+
+    // Checkpoint we continue from is added again.
+    if (!m_checkpoints.empty()) {
+        m_checkpoints.pop_back();
+    }
+
+    details::ParseState &state = m_result.m_state;
+    details::ResultSink sink(m_cmdLine, m_result, &m_undo);
+    std::ptrdiff_t lastPos = static_cast<std::ptrdiff_t>(m_reparsedFrom) - 1;
+
+    while (!m_context.atEnd() && !state.m_error) {
+        // Value of "--name=value" put back by the previous step keeps the
+        // index of its word, parsing can't be continued from such value.
+        const std::ptrdiff_t pos = static_cast<std::ptrdiff_t>(m_context.pos());
+        const bool isResumable = (pos > lastPos);
+
+        lastPos = pos;
+
+        m_checkpoints.push_back(Checkpoint{pos,
+                                           m_undo.size(),
+                                           state.m_occurrences.size(),
+                                           static_cast<std::size_t>(m_result.m_positional.size()),
+                                           state.m_prevCommand.size(),
+                                           state.m_isPositional,
+                                           isResumable});
+
+        m_cmdLine.parseWord(m_context, state, sink);
+    }
+
+    state.m_tokenIndex = ParseError::c_noToken;
+    state.m_word = details::StringView();
+
+    if (!state.m_error) {
+        sink.checkCorrectnessAfterParsing();
+    }
+
+    return m_result;
+}
+
+inline void Repl::reset()
+{
+    m_result = ParseResult();
+    m_result.m_cmdLine = &m_cmdLine;
+    m_result.m_args.resize(m_cmdLine.m_argsCount);
+
+    m_generation = m_cmdLine.m_frozenGeneration;
+
+    m_words.clear();
+    m_context = ContextView();
+    m_undo.clear();
+    m_checkpoints.clear();
+}
+
+inline void Repl::rollback(std::size_t checkpoint)
+{
+    details::ParseState &state = m_result.m_state;
+
+    if (checkpoint < m_checkpoints.size()) {
+        const Checkpoint &c = m_checkpoints[checkpoint];
+
+        while (m_undo.size() > c.m_undoCount) {
+            const details::ParsedArgUndo &u = m_undo.back();
+
+            u.m_parsed->m_isDefined = u.m_isDefined;
+            u.m_parsed->m_count = u.m_count;
+            u.m_parsed->m_subCommand = u.m_subCommand;
+            u.m_parsed->m_values.erase(std::next(u.m_parsed->m_values.begin(), u.m_valuesCount),
+                                       u.m_parsed->m_values.end());
+
+            m_undo.pop_back();
+        }
+
+        state.m_occurrences.resize(c.m_occurrencesCount);
+
+        m_result.m_positional.erase(std::next(m_result.m_positional.begin(), c.m_positionalCount),
+                                    m_result.m_positional.end());
+
+        state.m_prevCommand.resize(c.m_commandsCount);
+        state.m_command = (state.m_prevCommand.empty() ? nullptr : state.m_prevCommand.front());
+        state.m_currCommand = (state.m_prevCommand.empty() ? nullptr : state.m_prevCommand.back());
+        state.m_isPositional = c.m_isPositional;
+
+        // Checkpoint itself is kept to know where to continue from.
+        m_checkpoints.erase(m_checkpoints.begin() + static_cast<std::ptrdiff_t>(checkpoint) + 1,
+                            m_checkpoints.end());
+    }
+
+    state.m_error = ParseError();
+    state.m_tokenIndex = ParseError::c_noToken;
+    state.m_word = details::StringView();
+}
+
+} /* namespace Args */
+
+#endif // ARGS__REPL_HPP__INCLUDED
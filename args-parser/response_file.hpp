@@ -0,0 +1,276 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__RESPONSE_FILE_HPP__INCLUDED
+#define ARGS__RESPONSE_FILE_HPP__INCLUDED
+
+// Args include.
+#include "mapped_file.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// ResponseFile
+//
+
+/*!
+    Response file, i.e. "@file" word of the command line, with words
+    of the command line separated with white spaces.
+
+    Quoting rules are the same as in GCC: words can be quoted with
+    single or double quotes, and backslash escapes any next character.
+
+    File is mapped into the memory privately, words are unquoted in
+    place, so tokens are views to the mapping and only pages with
+    quoted words are copied.
+*/
+class ResponseFile final
+{
+public:
+    ResponseFile()
+        : m_pos(nullptr)
+        , m_end(nullptr)
+    {
+    }
+
+    /*!
+        Open the file with the given name.
+
+        \return false if the file can't be read.
+    */
+    bool open(const StringView &name)
+    {
+        if (!m_file.open(name)) {
+            return false;
+        }
+
+        m_pos = m_file.begin();
+        m_end = m_file.end();
+
+        return true;
+    }
+
+    //! \return Identity of the file, the same for all names of the file.
+    const std::string &id() const
+    {
+        return m_file.id();
+    }
+
+    /*!
+        Take next word of the file.
+
+        \return false if there are no more words.
+    */
+    bool next(StringView &token)
+    {
+        skipSpaces();
+
+        if (m_pos == m_end) {
+            return false;
+        }
+
+        Char *const first = m_pos;
+        Char *out = m_pos;
+        bool isSingleQuoted = false;
+        bool isDoubleQuoted = false;
+        bool isEscaped = false;
+
+        for (; m_pos != m_end; ++m_pos) {
+            const std::size_t c = charCode(*m_pos);
+
+            if (isEscaped) {
+                isEscaped = false;
+            } else if (c == '\\') {
+                isEscaped = true;
+
+                continue;
+            } else if (isSingleQuoted) {
+                if (c == '\'') {
+                    isSingleQuoted = false;
+
+                    continue;
+                }
+            } else if (isDoubleQuoted) {
+                if (c == '"') {
+                    isDoubleQuoted = false;
+
+                    continue;
+                }
+            } else if (isSpace(c)) {
+                break;
+            } else if (c == '\'') {
+                isSingleQuoted = true;
+
+                continue;
+            } else if (c == '"') {
+                isDoubleQuoted = true;
+
+                continue;
+            }
+
+            // Untouched pages of the mapping are not copied.
+            if (out != m_pos) {
+                *out = *m_pos;
+            }
+
+            ++out;
+        }
+
+        token = StringView(first, static_cast<std::size_t>(out - first));
+
+        return true;
+    }
+
+private:
+    DISABLE_COPY(ResponseFile)
+
+    //! \return Is the character a white space?
+    static bool isSpace(std::size_t c)
+    {
+        return (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f');
+    }
+
+    //! Skip white spaces.
+    void skipSpaces()
+    {
+        while (m_pos != m_end && isSpace(charCode(*m_pos))) {
+            ++m_pos;
+        }
+    }
+
+private:
+    //! File.
+    MappedFile m_file;
+    //! Current position.
+    Char *m_pos;
+    //! End of the content.
+    Char *m_end;
+}; // class ResponseFile
+
+//
+// ResponseFiles
+//
+
+//! Response files words of the context refer to.
+class ResponseFiles final
+{
+public:
+    //! Maximum depth of nested response files.
+    enum : std::size_t { c_maxDepth = 64 };
+
+    //! \return Is the word a response file, i.e. "@file"?
+    static bool isResponseFile(const StringView &word)
+    {
+        return (word.size() > 1 && word[0] == Char(SL('@')));
+    }
+
+    /*!
+        Replace response files in the words with their words. Nested
+        response files are replaced too. Response file that can't be
+        read is kept as is.
+
+        \return false if the response file includes itself or nesting
+            is deeper than c_maxDepth, \a failed is the index of the
+            word with response file and \a fileName is the name of the
+            file included recursively then, words aren't changed.
+    */
+    bool expand(std::vector<StringView> &words,
+                std::size_t &failed,
+                String &fileName)
+    {
+        if (std::none_of(words.cbegin(), words.cend(), &isResponseFile)) {
+            return true;
+        }
+
+        std::vector<StringView> res;
+        res.reserve(words.size());
+
+        std::vector<std::string> stack;
+
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            if (!isResponseFile(words[i])) {
+                res.push_back(words[i]);
+            } else if (!expand(words[i], res, stack, fileName)) {
+                failed = i;
+
+                return false;
+            }
+        }
+
+        words = std::move(res);
+
+        return true;
+    }
+
+    //! Release the files.
+    void clear()
+    {
+        m_files.clear();
+    }
+
+private:
+    //! Append words of the response file to \a res.
+    bool expand(const StringView &word,
+                std::vector<StringView> &res,
+                std::vector<std::string> &stack,
+                String &fileName)
+    {
+        auto file = std::make_shared<ResponseFile>();
+
+        if (!file->open(word.substr(1))) {
+            res.push_back(word);
+
+            return true;
+        }
+
+        if (stack.size() == c_maxDepth || std::find(stack.cbegin(), stack.cend(), file->id()) != stack.cend()) {
+            fileName = word.substr(1).toString();
+
+            return false;
+        }
+
+        m_files.push_back(file);
+        stack.push_back(file->id());
+
+        StringView token;
+
+        while (file->next(token)) {
+            if (!isResponseFile(token)) {
+                res.push_back(token);
+            } else if (!expand(token, res, stack, fileName)) {
+                return false;
+            }
+        }
+
+        stack.pop_back();
+
+        return true;
+    }
+
+private:
+    //! Files, shared by the copies of the parsed result.
+    std::vector<std::shared_ptr<ResponseFile>> m_files;
+}; // class ResponseFiles
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__RESPONSE_FILE_HPP__INCLUDED
@@ -0,0 +1,195 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__STATIC_ARG_HPP__INCLUDED
+#define ARGS__STATIC_ARG_HPP__INCLUDED
+
+// Args include.
+#include "types.hpp"
+
+namespace Args
+{
+
+namespace details
+{
+
+//! Type of characters in string literals.
+#ifdef ARGS_WSTRING_BUILD
+using LiteralChar = wchar_t;
+#else
+using LiteralChar = char;
+#endif
+
+} /* namespace details */
+
+//
+// StaticArg
+//
+
+//! Description of the argument in the StaticSchema.
+class StaticArg
+{
+public:
+    constexpr StaticArg()
+        : m_flag(0)
+        , m_name(nullptr)
+        , m_isWithValue(false)
+        , m_isRequired(false)
+        , m_isMulti(false)
+    {
+    }
+
+    //! Construct argument with flag and name.
+    constexpr StaticArg(
+        //! Flag for this argument.
+        details::LiteralChar flag,
+        //! Name for this argument.
+        const details::LiteralChar *name,
+        //! Is this argument with value?
+        bool isWithValue = false,
+        //! Is this argument required?
+        bool isRequired = false)
+        : m_flag(flag)
+        , m_name(name)
+        , m_isWithValue(isWithValue)
+        , m_isRequired(isRequired)
+        , m_isMulti(false)
+    {
+    }
+
+    //! Construct argument only with flag, without name.
+    constexpr explicit StaticArg(
+        //! Flag for this argument.
+        details::LiteralChar flag,
+        //! Is this argument with value?
+        bool isWithValue = false,
+        //! Is this argument required?
+        bool isRequired = false)
+        : m_flag(flag)
+        , m_name(nullptr)
+        , m_isWithValue(isWithValue)
+        , m_isRequired(isRequired)
+        , m_isMulti(false)
+    {
+    }
+
+    //! Construct argument only with name, without flag.
+    constexpr explicit StaticArg(
+        //! Name for this argument.
+        const details::LiteralChar *name,
+        //! Is this argument with value?
+        bool isWithValue = false,
+        //! Is this argument required?
+        bool isRequired = false)
+        : m_flag(0)
+        , m_name(name)
+        , m_isWithValue(isWithValue)
+        , m_isRequired(isRequired)
+        , m_isMulti(false)
+    {
+    }
+
+    //! \return Flag. 0 if argument doesn't have flag.
+    constexpr details::LiteralChar flag() const
+    {
+        return m_flag;
+    }
+
+    //! \return Name without leading dashes. nullptr if argument doesn't have name.
+    constexpr const details::LiteralChar *argumentName() const
+    {
+        return (m_name && m_name[0] ? m_name : nullptr);
+    }
+
+    //! \return Is this argument with value?
+    constexpr bool isWithValue() const
+    {
+        return m_isWithValue;
+    }
+
+    //! \return Is this argument required?
+    constexpr bool isRequired() const
+    {
+        return m_isRequired;
+    }
+
+    //! \return Can this argument be presented more than once or have
+    //! more than one value, as MultiArg?
+    constexpr bool isMulti() const
+    {
+        return m_isMulti;
+    }
+
+    //! \return Name of the argument, i.e. "--timeout" or "-t".
+    String name() const
+    {
+        if (argumentName()) {
+            return String(SL("--")) + String(m_name);
+        } else {
+            return String(SL("-")) + String(1, m_flag);
+        }
+    }
+
+protected:
+    //! Flag.
+    details::LiteralChar m_flag;
+    //! Name.
+    const details::LiteralChar *m_name;
+    //! Is this argument with value?
+    bool m_isWithValue;
+    //! Is this argument required?
+    bool m_isRequired;
+    //! Is this multi argument?
+    bool m_isMulti;
+}; // class StaticArg
+
+//
+// StaticMultiArg
+//
+
+//! Description of the multi argument in the StaticSchema, works as MultiArg.
+class StaticMultiArg : public StaticArg
+{
+public:
+    //! Construct argument with flag and name.
+    constexpr StaticMultiArg(details::LiteralChar flag,
+                             const details::LiteralChar *name,
+                             bool isWithValue = false,
+                             bool isRequired = false)
+        : StaticArg(flag,
+                    name,
+                    isWithValue,
+                    isRequired)
+    {
+        m_isMulti = true;
+    }
+
+    //! Construct argument only with flag, without name.
+    constexpr explicit StaticMultiArg(details::LiteralChar flag,
+                                      bool isWithValue = false,
+                                      bool isRequired = false)
+        : StaticArg(flag,
+                    isWithValue,
+                    isRequired)
+    {
+        m_isMulti = true;
+    }
+
+    //! Construct argument only with name, without flag.
+    constexpr explicit StaticMultiArg(const details::LiteralChar *name,
+                                      bool isWithValue = false,
+                                      bool isRequired = false)
+        : StaticArg(name,
+                    isWithValue,
+                    isRequired)
+    {
+        m_isMulti = true;
+    }
+}; // class StaticMultiArg
+
+} /* namespace Args */
+
+#endif // ARGS__STATIC_ARG_HPP__INCLUDED
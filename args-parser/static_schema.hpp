@@ -0,0 +1,958 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__STATIC_SCHEMA_HPP__INCLUDED
+#define ARGS__STATIC_SCHEMA_HPP__INCLUDED
+
+// Args include.
+#include "cmd_line.hpp"
+#include "exceptions.hpp"
+#include "parse_error.hpp"
+#include "static_arg.hpp"
+#include "string_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#ifdef ARGS_QSTRING_BUILD
+#include <vector>
+#endif
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// staticCode
+//
+
+//! \return Numeric code of the character.
+constexpr std::uint32_t staticCode(LiteralChar c)
+{
+    return static_cast<std::uint32_t>(static_cast<typename std::make_unsigned<LiteralChar>::type>(c));
+}
+
+#ifdef ARGS_QSTRING_BUILD
+//! \return Numeric code of the character.
+inline std::uint32_t staticCode(Char c)
+{
+    return c.unicode();
+}
+#endif
+
+//
+// staticHash
+//
+
+//! \return Seeded FNV-1a hash of the characters in the given range.
+template<typename Iterator>
+constexpr std::uint32_t staticHash(Iterator first,
+                                   Iterator last,
+                                   std::uint32_t seed)
+{
+    std::uint32_t hash = 2166136261u ^ static_cast<std::uint32_t>(seed * 2654435761u);
+
+    for (; first != last; ++first) {
+        hash = static_cast<std::uint32_t>((hash ^ staticCode(*first)) * 16777619u);
+    }
+
+    return hash;
+}
+
+//
+// literalLength
+//
+
+//! \return Length of the string literal.
+constexpr std::size_t literalLength(const LiteralChar *s)
+{
+    std::size_t length = 0;
+
+    if (s) {
+        while (s[length]) {
+            ++length;
+        }
+    }
+
+    return length;
+}
+
+//
+// isEqualLiterals
+//
+
+//! \return Are the given string literals equal?
+constexpr bool isEqualLiterals(const LiteralChar *s1,
+                               const LiteralChar *s2)
+{
+    const std::size_t length = literalLength(s1);
+
+    if (length != literalLength(s2)) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < length; ++i) {
+        if (s1[i] != s2[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// isCorrectFlagLiteral
+//
+
+//! \return Is flag correct? The same rules as in isCorrectFlag().
+constexpr bool isCorrectFlagLiteral(LiteralChar c)
+{
+    return ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+}
+
+//
+// isCorrectNameLiteral
+//
+
+//! \return Is name correct? The same rules as in isCorrectName().
+constexpr bool isCorrectNameLiteral(const LiteralChar *name)
+{
+    const std::size_t length = literalLength(name);
+
+    if (!length) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < length; ++i) {
+        if (!isCorrectFlagLiteral(name[i]) && name[i] != '-' && name[i] != '_') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// nextPowerOfTwo
+//
+
+//! \return The smallest power of two that is not less than the given value.
+constexpr std::size_t nextPowerOfTwo(std::size_t value)
+{
+    std::size_t res = 1;
+
+    while (res < value) {
+        res *= 2;
+    }
+
+    return res;
+}
+
+//
+// isEqualToLiteral
+//
+
+//! \return Are the characters in the given range equal to the string literal?
+template<typename Iterator>
+bool isEqualToLiteral(Iterator first,
+                      Iterator last,
+                      const LiteralChar *s)
+{
+    for (; first != last && *s; ++first, ++s) {
+        if (staticCode(*first) != staticCode(*s)) {
+            return false;
+        }
+    }
+
+    return (first == last && !*s);
+}
+
+//
+// PerfectHash
+//
+
+/*!
+    Perfect hash of N string literals built at compile time with "hash
+    and displace" algorithm: keys are distributed into buckets, then,
+    starting from the largest bucket, for each bucket is searched such
+    displacement that all keys of the bucket fall into free slots.
+
+    Keys are taken from Keys::key(i), nullptr keys are skipped.
+*/
+template<std::size_t N>
+class PerfectHash final
+{
+public:
+    enum : std::size_t {
+        //! Count of buckets of the first level.
+        c_bucketsCount = N,
+        //! Count of slots in the table.
+        c_slotsCount = nextPowerOfTwo(N) * 2
+    };
+
+    //! Count of tries to find displacement for one bucket.
+    enum : std::uint32_t { c_maxDisplacement = 4096 };
+
+    constexpr PerfectHash()
+        : m_displacements{}
+        , m_slots{}
+    {
+    }
+
+    /*!
+        Build the hash.
+
+        \return Index of the key that can't be placed or N on success.
+    */
+    template<typename Keys>
+    constexpr std::size_t build(const Keys &keys)
+    {
+        std::size_t bucketSize[c_bucketsCount] = {};
+        std::size_t bucketStart[c_bucketsCount + 1] = {};
+        std::size_t indexes[N] = {};
+        std::size_t order[c_bucketsCount] = {};
+        std::size_t fill[c_bucketsCount] = {};
+        std::uint32_t mark[c_slotsCount] = {};
+        std::uint32_t attempt = 0;
+
+        for (std::size_t i = 0; i < N; ++i) {
+            if (keys.key(i)) {
+                ++bucketSize[hashOf(keys.key(i), 0) % c_bucketsCount];
+            }
+        }
+
+        for (std::size_t b = 0; b < c_bucketsCount; ++b) {
+            bucketStart[b + 1] = bucketStart[b] + bucketSize[b];
+            order[b] = b;
+        }
+
+        for (std::size_t i = 0; i < N; ++i) {
+            if (keys.key(i)) {
+                const std::size_t b = hashOf(keys.key(i), 0) % c_bucketsCount;
+
+                indexes[bucketStart[b] + fill[b]++] = i;
+            }
+        }
+
+        // Insertion sort of buckets by size in descending order.
+        for (std::size_t i = 1; i < c_bucketsCount; ++i) {
+            const std::size_t b = order[i];
+            std::size_t j = i;
+
+            while (j > 0 && bucketSize[order[j - 1]] < bucketSize[b]) {
+                order[j] = order[j - 1];
+                --j;
+            }
+
+            order[j] = b;
+        }
+
+        for (std::size_t o = 0; o < c_bucketsCount && bucketSize[order[o]]; ++o) {
+            const std::size_t b = order[o];
+
+            std::uint32_t d = 1;
+
+            for (; d <= c_maxDisplacement; ++d) {
+                bool ok = true;
+
+                // Marks slots taken by this bucket with this attempt.
+                ++attempt;
+
+                for (std::size_t k = bucketStart[b]; k < bucketStart[b + 1]; ++k) {
+                    const std::size_t slot = hashOf(keys.key(indexes[k]), d) & (c_slotsCount - 1);
+
+                    if (m_slots[slot] || mark[slot] == attempt) {
+                        ok = false;
+
+                        break;
+                    }
+
+                    mark[slot] = attempt;
+                }
+
+                if (ok) {
+                    break;
+                }
+            }
+
+            if (d > c_maxDisplacement) {
+                return indexes[bucketStart[b]];
+            }
+
+            m_displacements[b] = d;
+
+            for (std::size_t k = bucketStart[b]; k < bucketStart[b + 1]; ++k) {
+                m_slots[hashOf(keys.key(indexes[k]), d) & (c_slotsCount - 1)] = static_cast<int>(indexes[k]) + 1;
+            }
+        }
+
+        return N;
+    }
+
+    /*!
+        \return Index of the only key that can be equal to the given
+            characters, -1 if there is no such key. Key should be compared
+            with the characters.
+    */
+    template<typename Iterator>
+    int candidate(Iterator first,
+                  Iterator last) const
+    {
+        const auto d = m_displacements[staticHash(first, last, 0) % c_bucketsCount];
+
+        if (!d) {
+            return -1;
+        }
+
+        return m_slots[staticHash(first, last, d) & (c_slotsCount - 1)] - 1;
+    }
+
+private:
+    //! \return Hash of the key.
+    static constexpr std::uint32_t hashOf(const LiteralChar *key,
+                                          std::uint32_t seed)
+    {
+        return staticHash(key, key + literalLength(key), seed);
+    }
+
+private:
+    //! Displacements of the buckets, 0 for empty bucket.
+    std::uint32_t m_displacements[c_bucketsCount];
+    //! Slots, index of the key + 1, 0 for empty slot.
+    int m_slots[c_slotsCount];
+}; // class PerfectHash
+
+} /* namespace details */
+
+//
+// StaticSchemaError
+//
+
+//! Error found in the StaticSchema.
+enum class StaticSchemaError {
+    //! Schema is correct.
+    NoError = 0,
+    //! Argument without flag and name.
+    EmptyFlagAndName,
+    //! Flag with disallowed character.
+    DisallowedFlag,
+    //! Name with disallowed characters.
+    DisallowedName,
+    //! Two arguments with the same flag.
+    FlagRedefinition,
+    //! Two arguments with the same name.
+    NameRedefinition,
+    //! Perfect hash for the names wasn't found.
+    PerfectHashNotFound
+}; // enum class StaticSchemaError
+
+template<std::size_t N>
+class StaticParseResult;
+
+//
+// StaticSchema
+//
+
+/*!
+    StaticSchema is a set of arguments known at compile time.
+
+    All checks that CmdLine does before parsing are done at compile
+    time, and names are looked up with perfect hash built at compile
+    time too. Use ARGS_STATIC_SCHEMA macro to declare schema, this macro
+    turns errors in the schema into static_assert failures.
+*/
+template<std::size_t N>
+class StaticSchema final
+{
+    static_assert(N > 0, "Static schema should have at least one argument.");
+
+public:
+    //! Count of buckets of the first level of perfect hash.
+    static constexpr std::size_t c_bucketsCount = details::PerfectHash<N>::c_bucketsCount;
+    //! Count of slots in the table of perfect hash.
+    static constexpr std::size_t c_slotsCount = details::PerfectHash<N>::c_slotsCount;
+    //! Count of tries to find displacement for one bucket.
+    static constexpr std::uint32_t c_maxDisplacement = details::PerfectHash<N>::c_maxDisplacement;
+
+    template<typename... T>
+    constexpr explicit StaticSchema(const T &...args)
+        : m_args{args...}
+        , m_error(StaticSchemaError::NoError)
+        , m_errorArgument(0)
+        , m_names()
+        , m_flags{}
+    {
+        static_assert(sizeof...(T) == N, "Wrong count of arguments in static schema.");
+
+        validate();
+
+        if (m_error == StaticSchemaError::NoError) {
+            buildFlags();
+            buildNames();
+        }
+    }
+
+    //! \return Count of arguments.
+    constexpr std::size_t size() const
+    {
+        return N;
+    }
+
+    //! \return Argument with the given index.
+    constexpr const StaticArg &argument(std::size_t i) const
+    {
+        return m_args[i];
+    }
+
+    //! \return Error in the schema.
+    constexpr StaticSchemaError error() const
+    {
+        return m_error;
+    }
+
+    //! \return Index of the argument with error.
+    constexpr std::size_t errorArgument() const
+    {
+        return m_errorArgument;
+    }
+
+    //! \return Index of the argument with the given flag, -1 if there is no such flag.
+    template<typename C>
+    int flagIndex(C c) const
+    {
+        const std::uint32_t code = details::staticCode(c);
+
+        return (code < 128 ? m_flags[code] - 1 : -1);
+    }
+
+    //! \return Index of the argument for the given name, i.e. "-t" or
+    //! "--timeout", -1 if there is no such argument.
+    int indexOf(const String &name) const
+    {
+        return indexOf(details::StringView(name));
+    }
+
+    //! \return Index of the argument for the given name, -1 if there is no such argument.
+    int indexOf(const details::StringView &name) const
+    {
+        if (details::isArgument(name)) {
+            return nameIndex(name.begin() + 2, name.end());
+        } else if (details::isFlag(name) && name.length() == 2) {
+            return flagIndex(name[1]);
+        } else {
+            return -1;
+        }
+    }
+
+    //! \return Index of the argument with the given name without leading
+    //! dashes, -1 if there is no such argument.
+    template<typename Iterator>
+    int nameIndex(Iterator first,
+                  Iterator last) const
+    {
+        const int i = m_names.candidate(first, last);
+
+        return (i >= 0 && details::isEqualToLiteral(first, last, m_args[i].argumentName()) ? i : -1);
+    }
+
+    //! Parse arguments. \throw BaseException on errors in the command line.
+    StaticParseResult<N> parse(
+#ifdef ARGS_WSTRING_BUILD
+        int argc,
+        const Char *const *argv,
+#else
+        int argc,
+        const char *const *argv,
+#endif
+        //! Should positional arguments be handled, as with CmdLine::HandlePositionalArguments?
+        bool handlePositionalArguments = false) const;
+
+    /*!
+        Parse arguments without throwing on errors in the command line.
+
+        \return Error of the parsing, it's false on success. Index of
+            the word is set for errors bound to the word, index of the
+            argument for errors about the argument. Message is formatted
+            on request, the error is valid while argv and the result
+            are alive.
+    */
+    ParseError tryParse(
+#ifdef ARGS_WSTRING_BUILD
+        int argc,
+        const Char *const *argv,
+#else
+        int argc,
+        const char *const *argv,
+#endif
+        //! Result of the parsing.
+        StaticParseResult<N> &result,
+        //! Should positional arguments be handled, as with CmdLine::HandlePositionalArguments?
+        bool handlePositionalArguments = false) const;
+
+private:
+    friend class details::PerfectHash<N>;
+
+    //! Check correctness of the arguments.
+    constexpr void validate()
+    {
+        for (std::size_t i = 0; i < N && m_error == StaticSchemaError::NoError; ++i) {
+            const StaticArg &a = m_args[i];
+
+            if (!a.flag() && !a.argumentName()) {
+                setError(StaticSchemaError::EmptyFlagAndName, i);
+            } else if (a.flag() && !details::isCorrectFlagLiteral(a.flag())) {
+                setError(StaticSchemaError::DisallowedFlag, i);
+            } else if (a.argumentName() && !details::isCorrectNameLiteral(a.argumentName())) {
+                setError(StaticSchemaError::DisallowedName, i);
+            } else {
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (a.flag() && a.flag() == m_args[j].flag()) {
+                        setError(StaticSchemaError::FlagRedefinition, i);
+
+                        break;
+                    }
+
+                    if (a.argumentName()
+                        && m_args[j].argumentName()
+                        && details::isEqualLiterals(a.argumentName(), m_args[j].argumentName())) {
+                        setError(StaticSchemaError::NameRedefinition, i);
+
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    //! Set error.
+    constexpr void setError(StaticSchemaError e,
+                            std::size_t i)
+    {
+        m_error = e;
+        m_errorArgument = i;
+    }
+
+    //! Build table of flags.
+    constexpr void buildFlags()
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (m_args[i].flag()) {
+                m_flags[details::staticCode(m_args[i].flag())] = static_cast<int>(i) + 1;
+            }
+        }
+    }
+
+    //! Build perfect hash of the names.
+    constexpr void buildNames()
+    {
+        const std::size_t failed = m_names.build(*this);
+
+        if (failed != N) {
+            setError(StaticSchemaError::PerfectHashNotFound, failed);
+        }
+    }
+
+    //! \return Name of the argument with the given index, key of the perfect hash.
+    constexpr const details::LiteralChar *key(std::size_t i) const
+    {
+        return m_args[i].argumentName();
+    }
+
+private:
+    //! Arguments.
+    StaticArg m_args[N];
+    //! Error.
+    StaticSchemaError m_error;
+    //! Index of the argument with error.
+    std::size_t m_errorArgument;
+    //! Perfect hash of the names.
+    details::PerfectHash<N> m_names;
+    //! Table of flags, index of the argument + 1, 0 if there is no such flag.
+    int m_flags[128];
+}; // class StaticSchema
+
+//
+// makeStaticSchema
+//
+
+//! \return Static schema with the given arguments.
+template<typename... T>
+constexpr StaticSchema<sizeof...(T)> makeStaticSchema(const T &...args)
+{
+    return StaticSchema<sizeof...(T)>(args...);
+}
+
+//
+// ARGS_STATIC_SCHEMA
+//
+
+//! Declare constexpr static schema with the given name and check it at compile time.
+#define ARGS_STATIC_SCHEMA(Name, ...)                                                                                  \
+    constexpr auto Name = ::Args::makeStaticSchema(__VA_ARGS__);                                                       \
+    static_assert(Name.error() != ::Args::StaticSchemaError::EmptyFlagAndName,                                         \
+                  "Arguments with empty flag and name are disallowed.");                                               \
+    static_assert(Name.error() != ::Args::StaticSchemaError::DisallowedFlag, "Disallowed flag in static schema.");     \
+    static_assert(Name.error() != ::Args::StaticSchemaError::DisallowedName, "Disallowed name in static schema.");     \
+    static_assert(Name.error() != ::Args::StaticSchemaError::FlagRedefinition,                                         \
+                  "Redefinition of argument with flag in static schema.");                                             \
+    static_assert(Name.error() != ::Args::StaticSchemaError::NameRedefinition,                                         \
+                  "Redefinition of argument with name in static schema.");                                             \
+    static_assert(Name.error() != ::Args::StaticSchemaError::PerfectHashNotFound,                                      \
+                  "Unable to build perfect hash for static schema.");
+
+//
+// StaticParseResult
+//
+
+//! Result of parsing of the command line with the StaticSchema.
+template<std::size_t N>
+class StaticParseResult final
+{
+    friend class StaticSchema<N>;
+
+public:
+    explicit StaticParseResult(const StaticSchema<N> &schema)
+        : m_schema(&schema)
+        , m_defined{}
+        , m_count{}
+    {
+    }
+
+    //! \return Is argument with the given index defined?
+    bool isDefined(std::size_t i) const
+    {
+        return m_defined[i];
+    }
+
+    //! \return Is argument with the given name defined?
+    bool isDefined(const String &name) const
+    {
+        const int i = m_schema->indexOf(name);
+
+        return (i >= 0 ? isDefined(i) : false);
+    }
+
+    //! \return Value of the argument with the given index.
+    const String &value(std::size_t i) const
+    {
+        return (!m_values[i].empty() ? m_values[i].front() : details::DummyString<>::c_string);
+    }
+
+    //! \return Value of the argument with the given name.
+    const String &value(const String &name) const
+    {
+        const int i = m_schema->indexOf(name);
+
+        return (i >= 0 ? value(i) : details::DummyString<>::c_string);
+    }
+
+    //! \return Values of the argument with the given index.
+    const StringList &values(std::size_t i) const
+    {
+        return m_values[i];
+    }
+
+    //! \return Values of the argument with the given name.
+    const StringList &values(const String &name) const
+    {
+        static const StringList empty;
+
+        const int i = m_schema->indexOf(name);
+
+        return (i >= 0 ? values(i) : empty);
+    }
+
+    /*!
+        \return Count of times that this argument was presented
+        in the command line if argument without value or count of values
+        if argument is with values.
+    */
+    std::size_t count(std::size_t i) const
+    {
+        return (m_schema->argument(i).isWithValue() ? static_cast<std::size_t>(m_values[i].size()) : m_count[i]);
+    }
+
+    //! \return Positional arguments.
+    const StringList &positional() const
+    {
+        return m_positional;
+    }
+
+private:
+    //! Schema.
+    const StaticSchema<N> *m_schema;
+    //! Defined arguments.
+    bool m_defined[N];
+    //! Counters of arguments without values.
+    std::size_t m_count[N];
+    //! Values.
+    StringList m_values[N];
+    //! Positional arguments.
+    StringList m_positional;
+#ifdef ARGS_QSTRING_BUILD
+    //! Decoded argv, words of the error are views to them.
+    std::vector<String> m_words;
+#endif
+}; // class StaticParseResult
+
+//
+// StaticSchema
+//
+
+template<std::size_t N>
+inline StaticParseResult<N> StaticSchema<N>::parse(
+#ifdef ARGS_WSTRING_BUILD
+    int argc,
+    const Char *const *argv,
+#else
+    int argc,
+    const char *const *argv,
+#endif
+    bool handlePositionalArguments) const
+{
+    StaticParseResult<N> res(*this);
+
+    const ParseError error = tryParse(argc, argv, res, handlePositionalArguments);
+
+    if (error) {
+        ARGS_THROW(BaseException(error.message()));
+    }
+
+    return res;
+}
+
+template<std::size_t N>
+inline ParseError StaticSchema<N>::tryParse(
+#ifdef ARGS_WSTRING_BUILD
+    int argc,
+    const Char *const *argv,
+#else
+    int argc,
+    const char *const *argv,
+#endif
+    StaticParseResult<N> &res,
+    bool handlePositionalArguments) const
+{
+    res = StaticParseResult<N>(*this);
+
+#ifdef ARGS_QSTRING_BUILD
+    // argv is decoded once, words are views to the decoded strings kept
+    // in the result, so the error can refer to them.
+    std::vector<String> &decoded = res.m_words;
+    decoded.reserve(static_cast<std::size_t>(argc > 0 ? argc : 0));
+
+    for (int i = 0; i < argc; ++i) {
+        decoded.push_back(String(argv[i]));
+    }
+
+    auto wordAt = [&decoded](int i) -> details::StringView {
+        return decoded[static_cast<std::size_t>(i)];
+    };
+#else
+    auto wordAt = [argv](int i) -> details::StringView {
+        return details::StringView(argv[i]);
+    };
+#endif
+
+    // \return Is the given word an argument or a block of flags, ignoring value after "=".
+    auto known = [this](const details::StringView &w) -> bool {
+        const auto eq = w.find(Char(SL('=')));
+        const details::StringView word = (eq == String::npos ? w : w.substr(0, static_cast<std::size_t>(eq)));
+
+        if (details::isFlag(word) && word.length() > 2) {
+            for (std::size_t j = 1, length = word.length(); j < length; ++j) {
+                if (flagIndex(word[j]) < 0) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        return (indexOf(word) >= 0);
+    };
+
+    // We skip first argv because of it's executable name.
+    int pos = 1;
+    // Index of the current word in argv.
+    int current = 0;
+
+    // \return Error bound to the current word, index of the word excludes executable name.
+    auto wordError = [&current](ParseErrorCode code, const details::StringView &word) -> ParseError {
+        ParseError error(code);
+        error.m_tokenIndex = static_cast<std::size_t>(current - 1);
+        error.m_word = word;
+
+        return error;
+    };
+
+    // \return Error about the argument with the given index bound to the current word.
+    auto argError = [this, &current](ParseErrorCode code, int i) -> ParseError {
+        ParseError error(code);
+        error.m_tokenIndex = static_cast<std::size_t>(current - 1);
+        error.m_staticArg = &m_args[i];
+        error.m_argumentIndex = static_cast<std::size_t>(i);
+
+        return error;
+    };
+
+    // \return Error of processing, it's false on success.
+    auto process = [&](int i, bool hasValue, const details::StringView &value) -> ParseError {
+        const StaticArg &a = m_args[i];
+
+        if (a.isMulti()) {
+            res.m_defined[i] = true;
+
+            if (!a.isWithValue()) {
+                ++res.m_count[i];
+
+                return ParseError();
+            }
+
+            bool found = false;
+
+            if (hasValue) {
+                res.m_values[i].push_back(value.toString());
+                found = true;
+            }
+
+            while (pos < argc && !known(wordAt(pos))) {
+                res.m_values[i].push_back(wordAt(pos++).toString());
+                found = true;
+            }
+
+            if (!found) {
+                return argError(ParseErrorCode::ValueRequired, i);
+            }
+        } else {
+            if (res.m_defined[i]) {
+                return argError(ParseErrorCode::AlreadyDefined, i);
+            }
+
+            if (a.isWithValue()) {
+                if (hasValue) {
+                    res.m_values[i].push_back(value.toString());
+                } else if (pos < argc && !known(wordAt(pos))) {
+                    res.m_values[i].push_back(wordAt(pos++).toString());
+                } else {
+                    return argError(ParseErrorCode::ValueRequired, i);
+                }
+            }
+
+            res.m_defined[i] = true;
+        }
+
+        return ParseError();
+    };
+
+    while (pos < argc) {
+        current = pos++;
+
+        const details::StringView word = wordAt(current);
+
+        details::StringView name = word;
+        details::StringView value;
+        bool hasValue = false;
+
+        const auto eqIt = word.find(Char(SL('=')));
+
+        if (eqIt != String::npos) {
+            value = word.substr(static_cast<std::size_t>(eqIt) + 1);
+            hasValue = !value.empty();
+            name = word.substr(0, static_cast<std::size_t>(eqIt));
+        }
+
+        if (details::isArgument(name)) {
+            const int i = indexOf(name);
+
+            if (i >= 0) {
+                const ParseError error = process(i, hasValue, value);
+
+                if (error) {
+                    return error;
+                }
+            } else if (handlePositionalArguments) {
+                // "--" itself isn't positional argument.
+                if (name.length() != 2 || eqIt != String::npos) {
+                    res.m_positional.push_back(word.toString());
+                }
+
+                break;
+            } else {
+                return wordError(ParseErrorCode::UnknownArgument, name);
+            }
+        } else if (details::isFlag(name)) {
+            const std::size_t length = name.length();
+
+            bool failed = false;
+
+            // Check all flags before processing, so nothing is changed on failure.
+            for (std::size_t j = 1; j < length && !failed; ++j) {
+                const int i = flagIndex(name[j]);
+
+                failed = true;
+
+                if (i < 0) {
+                    if (!handlePositionalArguments) {
+                        return wordError(ParseErrorCode::UnknownFlag, name.substr(j, 1));
+                    }
+                } else if (j < length - 1 && m_args[i].isWithValue()) {
+                    if (!handlePositionalArguments) {
+                        return wordError(ParseErrorCode::FlagsComboWithValue, name);
+                    }
+                } else {
+                    failed = false;
+                }
+            }
+
+            if (failed) {
+                res.m_positional.push_back(word.toString());
+
+                break;
+            }
+
+            for (std::size_t j = 1; j < length; ++j) {
+                const ParseError error = process(flagIndex(name[j]), (j == length - 1 && hasValue), value);
+
+                if (error) {
+                    return error;
+                }
+            }
+        } else if (handlePositionalArguments) {
+            res.m_positional.push_back(word.toString());
+
+            break;
+        } else {
+            return wordError(ParseErrorCode::UnknownArgument, name);
+        }
+    }
+
+    while (pos < argc) {
+        res.m_positional.push_back(wordAt(pos++).toString());
+    }
+
+    for (std::size_t i = 0; i < N; ++i) {
+        if (m_args[i].isRequired() && !res.m_defined[i]) {
+            ParseError error(ParseErrorCode::RequiredArgumentNotDefined);
+            error.m_staticArg = &m_args[i];
+            error.m_argumentIndex = i;
+
+            return error;
+        }
+    }
+
+    return ParseError();
+}
+
+} /* namespace Args */
+
+#endif // ARGS__STATIC_SCHEMA_HPP__INCLUDED
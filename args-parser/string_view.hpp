@@ -0,0 +1,180 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__STRING_VIEW_HPP__INCLUDED
+#define ARGS__STRING_VIEW_HPP__INCLUDED
+
+// Args include.
+#include "types.hpp"
+
+// C++ include.
+#include <cstddef>
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// StringView
+//
+
+/*!
+    Non-owning view to the characters of the string, i.e. of the argv
+    item or of the String.
+
+    \note Viewed characters should outlive the view.
+*/
+class StringView final
+{
+public:
+    StringView()
+        : m_data(nullptr)
+        , m_size(0)
+    {
+    }
+
+    StringView(const Char *data,
+               std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    //! View to the null-terminated string.
+    explicit StringView(const Char *str)
+        : m_data(str)
+        , m_size(0)
+    {
+        while (m_data[m_size] != Char(0)) {
+            ++m_size;
+        }
+    }
+
+    StringView(const String &str)
+        : m_data(str.data())
+        , m_size(static_cast<std::size_t>(str.length()))
+    {
+    }
+
+    //! \return Owning copy of the viewed characters.
+    String toString() const
+    {
+        return String(m_data, static_cast<String::size_type>(m_size));
+    }
+
+    operator String() const
+    {
+        return toString();
+    }
+
+    const Char *data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    std::size_t length() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return (m_size == 0);
+    }
+
+    const Char &operator[](std::size_t pos) const
+    {
+        return m_data[pos];
+    }
+
+    const Char *begin() const
+    {
+        return m_data;
+    }
+
+    const Char *end() const
+    {
+        return m_data + m_size;
+    }
+
+    //! \return View to the part of the characters.
+    StringView substr(std::size_t pos,
+                      std::size_t count = static_cast<std::size_t>(-1)) const
+    {
+        if (pos > m_size) {
+            pos = m_size;
+        }
+
+        return StringView(m_data + pos, (count < m_size - pos ? count : m_size - pos));
+    }
+
+    //! \return Position of the first given character or String::npos.
+    String::size_type find(Char c) const
+    {
+        for (std::size_t i = 0; i < m_size; ++i) {
+            if (m_data[i] == c) {
+                return static_cast<String::size_type>(i);
+            }
+        }
+
+        return String::npos;
+    }
+
+    friend bool operator==(const StringView &v,
+                           const String &s)
+    {
+        if (v.m_size != static_cast<std::size_t>(s.length())) {
+            return false;
+        }
+
+        const Char *data = s.data();
+
+        for (std::size_t i = 0; i < v.m_size; ++i) {
+            if (!(v.m_data[i] == data[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    friend bool operator==(const String &s,
+                           const StringView &v)
+    {
+        return (v == s);
+    }
+
+    friend bool operator!=(const StringView &v,
+                           const String &s)
+    {
+        return !(v == s);
+    }
+
+    friend bool operator!=(const String &s,
+                           const StringView &v)
+    {
+        return !(v == s);
+    }
+
+private:
+    //! Characters.
+    const Char *m_data;
+    //! Count of characters.
+    std::size_t m_size;
+}; // class StringView
+
+} /* namespace details */
+
+} /* namespace Args */
+
+#endif // ARGS__STRING_VIEW_HPP__INCLUDED
@@ -0,0 +1,584 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__TYPED_ARG_HPP__INCLUDED
+#define ARGS__TYPED_ARG_HPP__INCLUDED
+
+// Args include.
+#include "arg.hpp"
+#include "context.hpp"
+#include "exceptions.hpp"
+#include "multi_arg.hpp"
+#include "parse_error.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+// C++ include.
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// C include.
+#include <locale.h>
+#include <stdlib.h>
+
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+namespace Args
+{
+
+namespace details
+{
+
+//
+// fromChars
+//
+
+/*!
+    Convert decimal integer with optional sign from the given range of
+    characters, locale doesn't matter.
+
+    \return false if the range isn't an integer or is out of range.
+*/
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type fromChars(const Char *first,
+                                                                          const Char *last,
+                                                                          T &value,
+                                                                          //! Not used for integers.
+                                                                          std::string &)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+
+    bool isNegative = false;
+
+    if (first != last && (charCode(*first) == '-' || charCode(*first) == '+')) {
+        isNegative = (charCode(*first) == '-');
+
+        ++first;
+    }
+
+    if (first == last || (isNegative && !std::is_signed<T>::value)) {
+        return false;
+    }
+
+    const Unsigned max = static_cast<Unsigned>(std::numeric_limits<T>::max());
+    const Unsigned limit = (isNegative ? static_cast<Unsigned>(max + 1u) : max);
+
+    Unsigned result = 0;
+
+    for (; first != last; ++first) {
+        const std::size_t c = charCode(*first);
+
+        if (c < '0' || c > '9') {
+            return false;
+        }
+
+        const Unsigned digit = static_cast<Unsigned>(c - '0');
+
+        if (result > static_cast<Unsigned>((limit - digit) / 10u)) {
+            return false;
+        }
+
+        result = static_cast<Unsigned>(result * 10u + digit);
+    }
+
+    if (isNegative && result) {
+        value = static_cast<T>(-static_cast<T>(result - 1u) - 1);
+    } else {
+        value = static_cast<T>(result);
+    }
+
+    return true;
+} // fromChars
+
+//
+// CLocale
+//
+
+//! "C" locale for conversions that don't depend on the global locale.
+class CLocale final
+{
+public:
+#ifdef _WIN32
+    using Handle = _locale_t;
+#else
+    using Handle = locale_t;
+#endif
+
+    //! \return Locale created once, or null if it can't be created.
+    static Handle handle()
+    {
+        static const CLocale c_locale;
+
+        return c_locale.m_handle;
+    }
+
+    CLocale(const CLocale &) = delete;
+    CLocale &operator=(const CLocale &) = delete;
+
+private:
+    CLocale()
+#ifdef _WIN32
+        : m_handle(_create_locale(LC_ALL, "C"))
+#else
+        : m_handle(newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0)))
+#endif
+    {
+    }
+
+    ~CLocale()
+    {
+        if (m_handle) {
+#ifdef _WIN32
+            _free_locale(m_handle);
+#else
+            freelocale(m_handle);
+#endif
+        }
+    }
+
+    //! Handle.
+    Handle m_handle;
+}; // class CLocale
+
+//! \return Floating point number from the C string in the given locale.
+inline void strToFloat(const char *str,
+                       char **end,
+                       CLocale::Handle locale,
+                       float &value)
+{
+#ifdef _WIN32
+    value = _strtof_l(str, end, locale);
+#else
+    value = strtof_l(str, end, locale);
+#endif
+}
+
+//! \return Floating point number from the C string in the given locale.
+inline void strToFloat(const char *str,
+                       char **end,
+                       CLocale::Handle locale,
+                       double &value)
+{
+#ifdef _WIN32
+    value = _strtod_l(str, end, locale);
+#else
+    value = strtod_l(str, end, locale);
+#endif
+}
+
+//! \return Floating point number from the C string in the given locale.
+inline void strToFloat(const char *str,
+                       char **end,
+                       CLocale::Handle locale,
+                       long double &value)
+{
+#ifdef _WIN32
+    value = _strtold_l(str, end, locale);
+#else
+    value = strtold_l(str, end, locale);
+#endif
+}
+
+/*!
+    Convert decimal floating point number with "." as the decimal point
+    from the given range of characters, locale doesn't matter.
+
+    \return false if the range isn't a number or is out of range.
+*/
+template<typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type fromChars(const Char *first,
+                                                                                const Char *last,
+                                                                                T &value,
+                                                                                //! Buffer for the C string.
+                                                                                std::string &buf)
+{
+    // Converted in "C" locale, so neither the global locale nor its
+    // changes from other threads matter.
+    const CLocale::Handle locale = CLocale::handle();
+
+    if (first == last || !locale) {
+        return false;
+    }
+
+    // Only characters of decimal numbers are allowed, so no spaces, hex or names.
+    buf.clear();
+
+    for (; first != last; ++first) {
+        const std::size_t c = charCode(*first);
+
+        if (c >= '0' && c <= '9') {
+            buf.push_back(static_cast<char>(c));
+        } else if (c == '-' || c == '+' || c == 'e' || c == 'E' || c == '.') {
+            buf.push_back(static_cast<char>(c));
+        } else {
+            return false;
+        }
+    }
+
+    char *end = nullptr;
+    T result = 0;
+
+    errno = 0;
+
+    strToFloat(buf.c_str(), &end, locale, result);
+
+    if (end != buf.c_str() + buf.size() || (errno == ERANGE && std::isinf(result))) {
+        return false;
+    }
+
+    value = result;
+
+    return true;
+} // fromChars
+
+//
+// fromString
+//
+
+/*!
+    Convert integer or floating point number, locale doesn't matter.
+
+    \return false if the string isn't a number or is out of range.
+*/
+template<typename T>
+bool fromString(const String &str,
+                T &value)
+{
+    std::string buf;
+
+    return fromChars(str.data(), str.data() + str.size(), value, buf);
+} // fromString
+
+} /* namespace details */
+
+//
+// TypedArg
+//
+
+/*!
+    Argument with one value converted to T once on parsing.
+
+    T is an integer or a floating point type. Value that can't be
+    converted is reported as ParseErrorCode::InvalidValue.
+*/
+template<typename T>
+class TypedArg : public Arg
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "TypedArg supports only integer and floating point types.");
+
+public:
+    //! Construct argument with flag and name.
+    template<typename N>
+    TypedArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Name for this argument.
+        N &&name,
+        //! Is this argument required?
+        bool isRequired = false)
+        : Arg(flag,
+              std::forward<N>(name),
+              true,
+              isRequired)
+        , m_typedValue()
+        , m_defaultTypedValue()
+    {
+    }
+
+    //! Construct argument only with flag, without name.
+    explicit TypedArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Is this argument required?
+        bool isRequired = false)
+        : Arg(flag,
+              true,
+              isRequired)
+        , m_typedValue()
+        , m_defaultTypedValue()
+    {
+    }
+
+    //! Construct argument only with name, without flag.
+    template<typename N>
+    explicit TypedArg(
+        //! Name for this argument.
+        N &&name,
+        //! Is this argument required?
+        bool isRequired = false)
+        : Arg(std::forward<N>(name),
+              true,
+              isRequired)
+        , m_typedValue()
+        , m_defaultTypedValue()
+    {
+    }
+
+    virtual ~TypedArg()
+    {
+    }
+
+    //! \return Converted value of this argument or converted default value.
+    T typedValue() const
+    {
+        return (isDefined() ? m_typedValue : m_defaultTypedValue);
+    }
+
+    /*!
+        Set default value.
+
+        \throw BaseException if the value can't be converted to T.
+    */
+    TypedArg &setDefaultValue(const String &v) override
+    {
+        if (!details::fromString(v, m_defaultTypedValue)) {
+            ARGS_THROW(BaseException(String(SL("Invalid default value \""))
+                                     + v
+                                     + SL("\" of argument \"")
+                                     + name()
+                                     + SL("\".")));
+        }
+
+        Arg::setDefaultValue(v);
+
+        return *this;
+    }
+
+    //! \return Can the given string be converted to T?
+    bool isValueValid(const String &value) const override
+    {
+        T tmp;
+
+        return details::fromString(value, tmp);
+    }
+
+    //! Clear state of the argument.
+    void clear() override
+    {
+        Arg::clear();
+
+        m_typedValue = T();
+    }
+
+protected:
+    //! Process argument and convert its value.
+    void process(
+        //! Context of the command line.
+        Context &context) override
+    {
+        const bool wasDefined = isDefined();
+
+        Arg::process(context);
+
+        if (!wasDefined && isDefined() && !details::fromString(value(), m_typedValue)) {
+            details::reportError(cmdLine(), ParseError::invalidValue(this, value()));
+        }
+    }
+
+private:
+    DISABLE_COPY(TypedArg)
+
+    //! Converted value.
+    T m_typedValue;
+    //! Converted default value.
+    T m_defaultTypedValue;
+}; // class TypedArg
+
+//
+// TypedMultiArg
+//
+
+/*!
+    Argument with many values converted to T once on parsing.
+
+    T is an integer or a floating point type. Value that can't be
+    converted is reported as ParseErrorCode::InvalidValue.
+*/
+template<typename T>
+class TypedMultiArg : public MultiArg
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "TypedMultiArg supports only integer and floating point types.");
+
+public:
+    //! Construct argument with flag and name.
+    template<typename N>
+    TypedMultiArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Name for this argument.
+        N &&name,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(flag,
+                   std::forward<N>(name),
+                   true,
+                   isRequired)
+    {
+    }
+
+    //! Construct argument only with flag, without name.
+    explicit TypedMultiArg(
+        //! Flag for this argument.
+        Char flag,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(flag,
+                   true,
+                   isRequired)
+    {
+    }
+
+    //! Construct argument only with name, without flag.
+    template<typename N>
+    explicit TypedMultiArg(
+        //! Name for this argument.
+        N &&name,
+        //! Is this argument required?
+        bool isRequired = false)
+        : MultiArg(std::forward<N>(name),
+                   true,
+                   isRequired)
+    {
+    }
+
+    virtual ~TypedMultiArg()
+    {
+    }
+
+    //! \return Converted values of this argument or converted default values.
+    const std::vector<T> &typedValues() const
+    {
+        return (isDefined() ? m_typedValues : m_defaultTypedValues);
+    }
+
+    //! \return First converted value of this argument or T() if there are no values.
+    T typedValue() const
+    {
+        const std::vector<T> &values = typedValues();
+
+        return (values.empty() ? T() : values.front());
+    }
+
+    /*!
+        Set default value. \note Value will be pushed back to the list
+        of default values.
+
+        \throw BaseException if the value can't be converted to T.
+    */
+    TypedMultiArg &setDefaultValue(const String &v) override
+    {
+        m_defaultTypedValues.push_back(convertDefault(v));
+
+        MultiArg::setDefaultValue(v);
+
+        return *this;
+    }
+
+    /*!
+        Set default values.
+
+        \throw BaseException if any value can't be converted to T.
+    */
+    TypedMultiArg &setDefaultValues(const StringList &v)
+    {
+        std::vector<T> values;
+        values.reserve(static_cast<std::size_t>(v.size()));
+
+        for (const auto &s : v) {
+            values.push_back(convertDefault(s));
+        }
+
+        m_defaultTypedValues = std::move(values);
+
+        MultiArg::setDefaultValues(v);
+
+        return *this;
+    }
+
+    //! \return Can the given string be converted to T?
+    bool isValueValid(const String &value) const override
+    {
+        T tmp;
+
+        return details::fromString(value, tmp);
+    }
+
+    //! Clear state of the argument.
+    void clear() override
+    {
+        MultiArg::clear();
+
+        m_typedValues.clear();
+    }
+
+protected:
+    //! Process argument and convert its new values.
+    void process(
+        //! Context of the command line.
+        Context &context) override
+    {
+        MultiArg::process(context);
+
+        if (isDefined()) {
+            const StringList &all = values();
+
+            for (auto it = std::next(all.begin(), static_cast<std::ptrdiff_t>(m_typedValues.size())),
+                      last = all.end();
+                 it != last;
+                 ++it) {
+                T v = T();
+
+                if (!details::fromString(*it, v)) {
+                    details::reportError(cmdLine(), ParseError::invalidValue(this, *it));
+
+                    break;
+                }
+
+                m_typedValues.push_back(v);
+            }
+        }
+    }
+
+private:
+    //! \return Converted default value.
+    T convertDefault(const String &v) const
+    {
+        T value = T();
+
+        if (!details::fromString(v, value)) {
+            ARGS_THROW(BaseException(String(SL("Invalid default value \""))
+                                     + v
+                                     + SL("\" of argument \"")
+                                     + name()
+                                     + SL("\".")));
+        }
+
+        return value;
+    }
+
+private:
+    DISABLE_COPY(TypedMultiArg)
+
+    //! Converted values.
+    std::vector<T> m_typedValues;
+    //! Converted default values.
+    std::vector<T> m_defaultTypedValues;
+}; // class TypedMultiArg
+
+} /* namespace Args */
+
+#endif // ARGS__TYPED_ARG_HPP__INCLUDED
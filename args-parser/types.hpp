@@ -23,6 +23,7 @@
 #elif defined(ARGS_QSTRING_BUILD)
 // Qt include.
 #include <QString>
+#include <QStringList>
 #include <QTextStream>
 
 #ifdef ARGS_LIST
@@ -264,6 +265,11 @@ public:
         return m_str[pos];
     }
 
+    const Char *data() const
+    {
+        return m_str.constData();
+    }
+
     String &append(const String &other)
     {
         m_str.append(other.m_str);
@@ -350,21 +356,29 @@ template<typename T>
 class Deleter
 {
 public:
-    explicit Deleter(bool shouldIDelete)
+    explicit Deleter(bool shouldIDelete,
+                     bool isInArena = false)
         : m_delete(shouldIDelete)
+        , m_isInArena(isInArena)
     {
     }
 
     void operator()(T *obj) noexcept
     {
         if (m_delete) {
-            delete obj;
+            if (m_isInArena) {
+                obj->~T();
+            } else {
+                delete obj;
+            }
         }
     }
 
 private:
     //! Should deleter delete object?
     bool m_delete;
+    //! Is object placed in the arena, i.e. only destructor should be called?
+    bool m_isInArena;
 }; // class Deleter
 
 } /* namespace details */
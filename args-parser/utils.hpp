@@ -8,10 +8,12 @@
 #define ARGS__UTILS_HPP__INCLUDED
 
 // Args include.
+#include "string_view.hpp"
 #include "types.hpp"
 
 // C++ include.
 #include <algorithm>
+#include <cstddef>
 #include <type_traits>
 
 namespace Args
@@ -58,6 +60,12 @@ void asConst(const T &&) = delete;
 static inline bool isArgument(const String &word)
 {
     return (word.find(SL("--")) == 0);
+}
+
+//! \return Is word an argument? The same as above without copying the word.
+static inline bool isArgument(const StringView &word)
+{
+    return (word.length() >= 2 && word[0] == Char(SL('-')) && word[1] == Char(SL('-')));
 } // isArgument
 
 //
@@ -74,6 +82,12 @@ static inline bool isFlag(const String &word)
     }
 
     return false;
+}
+
+//! \return Is word a flag? The same as above without copying the word.
+static inline bool isFlag(const StringView &word)
+{
+    return (!word.empty() && word[0] == Char(SL('-')) && !isArgument(word));
 } // isFlag
 
 //
@@ -141,6 +155,39 @@ static inline bool isMisspelledName(const String &misspelled,
     }
 }
 
+//
+// charCode
+//
+
+//! \return Numeric code of the character.
+static inline std::size_t charCode(Char c)
+{
+#ifdef ARGS_QSTRING_BUILD
+    return c.unicode();
+#else
+    return static_cast<std::size_t>(static_cast<typename std::make_unsigned<Char>::type>(c));
+#endif
+} // charCode
+
+//
+// hashString
+//
+
+//! \return FNV-1a hash of the characters in the given range.
+template<typename Iterator>
+std::size_t hashString(Iterator first,
+                       Iterator last)
+{
+    std::size_t hash = 2166136261u;
+
+    for (; first != last; ++first) {
+        hash ^= charCode(*first);
+        hash *= 16777619u;
+    }
+
+    return hash;
+} // hashString
+
 template<typename T = void>
 struct DummyString {
     static const String c_string;
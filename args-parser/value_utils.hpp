@@ -8,41 +8,124 @@
 #define ARGS__VALUE_UTILS_HPP__INCLUDED
 
 // Args include.
+#include "context.hpp"
 #include "exceptions.hpp"
+#include "parse_error.hpp"
+#include "string_view.hpp"
 #include "types.hpp"
 #include "utils.hpp"
 
 // C++ include.
-#include <algorithm>
+#include <cstddef>
 
 namespace Args
 {
 
+namespace details
+{
+
+//
+// isKnownWord
+//
+
+/*!
+    \return Is the word at the given offset from the current item of
+        the context a known argument in the current scope?
+
+    Words classified as values aren't looked up.
+*/
+template<typename Cmd,
+         typename Ctx>
+bool isKnownWord(const Ctx &context,
+                 std::size_t offset,
+                 const StringView &word,
+                 const Cmd *cmdLine)
+{
+    switch (context.tag(offset)) {
+    case TokenTag::Value:
+    case TokenTag::Separator:
+        return false;
+
+    case TokenTag::LongOption:
+    case TokenTag::FlagBlock: {
+        const String::size_type splitOffset = context.splitOffset(word, offset);
+
+        const StringView name =
+            (splitOffset == String::npos ? word : word.substr(0, static_cast<std::size_t>(splitOffset)));
+
+        if (context.tag(offset) == TokenTag::LongOption || name.length() == 2) {
+            return (cmdLine->findArgument(name) != nullptr);
+        }
+
+        // Every flag of the block should be known.
+        for (std::size_t i = 1, length = name.length(); i < length; ++i) {
+            if (!cmdLine->findFlag(name[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    default:
+        return (cmdLine->findArgument(word) != nullptr);
+    }
+} // isKnownWord
+
+//
+// toBool
+//
+
+//! Convert value of the argument without value to bool. \return false if the value isn't boolean.
+static inline bool toBool(const StringView &value,
+                          bool &res)
+{
+    static const String c_on[] = {SL("true"), SL("yes"), SL("on"), SL("1")};
+    static const String c_off[] = {SL("false"), SL("no"), SL("off"), SL("0")};
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        if (value == c_on[i]) {
+            res = true;
+
+            return true;
+        }
+
+        if (value == c_off[i]) {
+            res = false;
+
+            return true;
+        }
+    }
+
+    return false;
+} // toBool
+
 //
 // eatValues
 //
 
-//! Eat values in context.
+//! Eat values in context. \return false if there are no values.
 template<typename Container,
          typename Cmd,
          typename Ctx>
 bool eatValues(Ctx &context,
                Container &container,
-               const String &errorDescription,
                Cmd *cmdLine)
 {
     if (!context.atEnd()) {
         auto begin = context.begin();
+        auto last = begin;
 
-        auto last = std::find_if(context.begin(), context.end(), [&](const String &v) -> bool {
-            return (cmdLine->findArgument(v) != nullptr);
-        });
+        for (std::size_t offset = 0; last != context.end() && !details::isKnownWord(context, offset, *last, cmdLine);
+             ++offset) {
+            ++last;
+        }
 
         if (last != begin) {
             begin = context.next();
 
             while (begin != last) {
-                container.push_back(*begin);
+                container.push_back(begin->toString());
 
                 begin = context.next();
             }
@@ -55,7 +138,91 @@ bool eatValues(Ctx &context,
         }
     }
 
-    throw BaseException(errorDescription);
+    return false;
+}
+
+//
+// convertValues
+//
+
+/*!
+    Eat values of the argument in context and pass each of them to
+    \a convert, that returns false if the value is invalid. Argument
+    is defined if any value is eaten, parsing stops on the first
+    invalid value. Message of the error is formatted on request.
+*/
+template<typename A,
+         typename Cmd,
+         typename Ctx,
+         typename Convert>
+void convertValues(Ctx &context,
+                   A *arg,
+                   Cmd *cmdLine,
+                   Convert convert)
+{
+    bool isEaten = false;
+
+    while (!context.atEnd() && !details::isKnownWord(context, 0, *context.begin(), cmdLine)) {
+        const details::StringView word = *context.next();
+
+        isEaten = true;
+
+        if (!convert(word)) {
+            arg->setDefined(true);
+
+            details::reportError(cmdLine, ParseError::invalidValue(arg, word.toString()));
+
+            return;
+        }
+    }
+
+    if (isEaten) {
+        arg->setDefined(true);
+    } else {
+        details::reportError(cmdLine, ParseError(ParseErrorCode::ValueRequired, arg));
+    }
+}
+
+} /* namespace details */
+
+//
+// eatValues
+//
+
+//! Eat values in context.
+template<typename Container,
+         typename Cmd,
+         typename Ctx>
+bool eatValues(Ctx &context,
+               Container &container,
+               const String &errorDescription,
+               Cmd *cmdLine)
+{
+    if (details::eatValues(context, container, cmdLine)) {
+        return true;
+    }
+
+    details::reportError(cmdLine, ParseError(errorDescription));
+
+    return false;
+}
+
+//! Eat values of the argument in context. Message of the error is formatted on request.
+template<typename Container,
+         typename Cmd,
+         typename Ctx>
+bool eatValues(Ctx &context,
+               Container &container,
+               const ArgIface *arg,
+               Cmd *cmdLine)
+{
+    if (details::eatValues(context, container, cmdLine)) {
+        return true;
+    }
+
+    details::reportError(cmdLine, ParseError(ParseErrorCode::ValueRequired, arg));
+
+    return false;
 }
 
 //
@@ -70,16 +237,32 @@ String eatOneValue(Ctx &context,
                    Cmd *cmdLine)
 {
     if (!context.atEnd()) {
-        auto val = context.next();
-
-        if (!cmdLine->findArgument(*val)) {
-            return *val;
+        if (!details::isKnownWord(context, 0, *context.begin(), cmdLine)) {
+            return context.next()->toString();
         }
+    }
+
+    details::reportError(cmdLine, ParseError(errorDescription));
+
+    return String();
+}
 
-        context.putBack();
+//! Eat one value of the argument. Message of the error is formatted on request.
+template<typename Cmd,
+         typename Ctx>
+String eatOneValue(Ctx &context,
+                   const ArgIface *arg,
+                   Cmd *cmdLine)
+{
+    if (!context.atEnd()) {
+        if (!details::isKnownWord(context, 0, *context.begin(), cmdLine)) {
+            return context.next()->toString();
+        }
     }
 
-    throw BaseException(errorDescription);
+    details::reportError(cmdLine, ParseError(ParseErrorCode::ValueRequired, arg));
+
+    return String();
 }
 
 } /* namespace Args */
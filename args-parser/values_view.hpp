@@ -0,0 +1,181 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#ifndef ARGS__VALUES_VIEW_HPP__INCLUDED
+#define ARGS__VALUES_VIEW_HPP__INCLUDED
+
+// Args include.
+#include "types.hpp"
+
+// C++ include.
+#include <cstddef>
+#include <iterator>
+
+namespace Args
+{
+
+//
+// ValuesView
+//
+
+/*!
+    Non-owning view to the values of the argument. Values are not
+    copied, so the argument should outlive the view and shouldn't be
+    changed while the view is in use.
+
+    View is either over the list of values of MultiArg or Command, or
+    over the single value of Arg.
+*/
+class ValuesView final
+{
+public:
+    //! Iterator.
+    class const_iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = String;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const String *;
+        using reference = const String &;
+
+        const_iterator()
+            : m_single(nullptr)
+            , m_isSingle(false)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (m_isSingle ? *m_single : *m_it);
+        }
+
+        pointer operator->() const
+        {
+            return &(**this);
+        }
+
+        const_iterator &operator++()
+        {
+            if (m_isSingle) {
+                m_single = nullptr;
+            } else {
+                ++m_it;
+            }
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+
+            ++(*this);
+
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator &i1,
+                               const const_iterator &i2)
+        {
+            return (i1.m_isSingle ? i1.m_single == i2.m_single : i1.m_it == i2.m_it);
+        }
+
+        friend bool operator!=(const const_iterator &i1,
+                               const const_iterator &i2)
+        {
+            return !(i1 == i2);
+        }
+
+    private:
+        friend class ValuesView;
+
+        //! Single value, nullptr at end.
+        const String *m_single;
+        //! Iterator in the list.
+        StringList::const_iterator m_it;
+        //! Is iterator over the single value?
+        bool m_isSingle;
+    }; // class const_iterator
+
+    //! Empty view.
+    ValuesView()
+        : m_list(nullptr)
+        , m_single(nullptr)
+    {
+    }
+
+    //! View to the list of values.
+    explicit ValuesView(const StringList &list)
+        : m_list(&list)
+        , m_single(nullptr)
+    {
+    }
+
+    //! View to the single value.
+    explicit ValuesView(const String &single)
+        : m_list(nullptr)
+        , m_single(&single)
+    {
+    }
+
+    //! \return Iterator to the first value.
+    const_iterator begin() const
+    {
+        const_iterator it;
+
+        if (m_list) {
+            it.m_it = m_list->cbegin();
+        } else {
+            it.m_isSingle = true;
+            it.m_single = m_single;
+        }
+
+        return it;
+    }
+
+    //! \return Iterator past the last value.
+    const_iterator end() const
+    {
+        const_iterator it;
+
+        if (m_list) {
+            it.m_it = m_list->cend();
+        } else {
+            it.m_isSingle = true;
+        }
+
+        return it;
+    }
+
+    //! \return Count of values.
+    std::size_t size() const
+    {
+        return (m_list ? static_cast<std::size_t>(m_list->size()) : (m_single ? 1 : 0));
+    }
+
+    //! \return Is view empty?
+    bool empty() const
+    {
+        return (size() == 0);
+    }
+
+    //! \return First value. \note View shouldn't be empty.
+    const String &front() const
+    {
+        return *begin();
+    }
+
+private:
+    //! List of values.
+    const StringList *m_list;
+    //! Single value.
+    const String *m_single;
+}; // class ValuesView
+
+} /* namespace Args */
+
+#endif // ARGS__VALUES_VIEW_HPP__INCLUDED
@@ -742,3 +742,53 @@ TEST_CASE("CommandInGroup7")
 
     REQUIRE(false);
 }
+
+TEST_CASE("TestArena")
+{
+    const int argc = 6;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("add"), SL("-f"), SL("test.txt"), SL("-d"), SL("-r")};
+
+    CmdLine cmd(argc, argv, CmdLine::CommandIsRequired | CmdLine::UseArena);
+
+    REQUIRE(cmd.arena());
+    REQUIRE(cmd.arena()->size() == 0);
+
+    cmd.addCommand(SL("add"), ValueOptions::NoValue, false, SL("Add file."))
+        .addAllOfGroup(SL("file group"))
+        .addArgWithFlagAndName(SL('f'), SL("file"), true, false, SL("Name of the file."))
+        .end()
+        .addArgWithFlagOnly(SL('d'))
+        .end()
+        .addArgWithFlagAndName(SL('r'), SL("recursive"))
+        .addHelp(true, argv[0]);
+
+    REQUIRE(cmd.arena()->size() >= sizeof(Command) + sizeof(AllOfGroup) + 3 * sizeof(Arg) + sizeof(Help));
+    REQUIRE(cmd.arena()->blocksCount() == 1);
+
+    cmd.parse();
+
+    REQUIRE(cmd.isDefined(SL("add")));
+    REQUIRE(cmd.value(SL("-f")) == SL("test.txt"));
+    REQUIRE(cmd.isDefined(SL("-d")));
+    REQUIRE(cmd.isDefined(SL("--recursive")));
+
+    CmdLine heap;
+
+    heap.addArgWithFlagOnly(SL('d'));
+
+    REQUIRE(!heap.arena());
+}
+
+TEST_CASE("TestArenaAlignment")
+{
+    details::Arena arena(64);
+
+    void *c = arena.allocate(1, 1);
+    void *d = arena.allocate(sizeof(double), alignof(double));
+    void *big = arena.allocate(1000, 16);
+
+    REQUIRE(c != d);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(d) % alignof(double) == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(big) % 16 == 0);
+    REQUIRE(arena.blocksCount() == 2);
+}
@@ -11,6 +11,9 @@
 // Args include.
 #include <args-parser/all.hpp>
 
+// C++ include.
+#include <memory>
+
 using namespace Args;
 
 #ifdef ARGS_WSTRING_BUILD
@@ -314,3 +317,253 @@ TEST_CASE("TestWrongPositionalArgument")
 
     REQUIRE(false);
 }
+
+TEST_CASE("TestFindArgumentAfterTreeChanges")
+{
+    CmdLine cmd;
+
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+    Arg verbose(SL('v'));
+
+    cmd.addArg(timeout);
+
+    REQUIRE(cmd.findArgument(SL("-t")) == &timeout);
+    REQUIRE(cmd.findArgument(SL("--timeout")) == &timeout);
+    REQUIRE(!cmd.findArgument(SL("-v")));
+
+    cmd.addArg(verbose);
+
+    REQUIRE(cmd.findArgument(SL("-v")) == &verbose);
+    REQUIRE(!cmd.findArgument(SL("--")));
+
+    verbose.setArgumentName(SL("verbose"));
+
+    REQUIRE(cmd.findArgument(SL("--verbose")) == &verbose);
+
+    OnlyOneGroup g(SL("group"));
+
+    cmd.addArg(g);
+
+    Arg port(SL('p'), String(SL("port")), true);
+
+    g.addArg(port);
+
+    REQUIRE(cmd.findArgument(SL("--port")) == &port);
+    REQUIRE(!cmd.findArgument(SL("group")));
+
+    cmd.addCommand(SL("add")).addArgWithFlagOnly(SL('a'));
+
+    REQUIRE(cmd.findArgument(SL("add")));
+    REQUIRE(cmd.findArgument(SL("add"))->type() == ArgType::Command);
+    REQUIRE(!cmd.findArgument(SL("-a")));
+}
+
+TEST_CASE("TestFlagsCombo")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-vdt"), SL("100")};
+
+    CmdLine cmd(argc, argv);
+
+    Arg verbose(SL('v'));
+    Arg debug(SL('d'));
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+
+    cmd.addArg(verbose);
+    cmd.addArg(debug);
+    cmd.addArg(timeout);
+
+    cmd.parse();
+
+    REQUIRE(verbose.isDefined());
+    REQUIRE(debug.isDefined());
+    REQUIRE(timeout.isDefined());
+    REQUIRE(timeout.value() == SL("100"));
+}
+
+TEST_CASE("TestWrongFlagsCombo")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-vtd"), SL("100")};
+
+    CmdLine cmd(argc, argv);
+
+    Arg verbose(SL('v'));
+    Arg debug(SL('d'));
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+
+    cmd.addArg(verbose);
+    cmd.addArg(debug);
+    cmd.addArg(timeout);
+
+    try {
+        cmd.parse();
+    } catch (const BaseException &x) {
+        REQUIRE(x.desc() == String(SL("Only last argument in flags combo can be with value. Flags combo is \"-vtd\".")));
+        REQUIRE(!verbose.isDefined());
+
+        return;
+    }
+
+    REQUIRE(false);
+}
+
+TEST_CASE("TestUnknownFlagInCombo")
+{
+    const int argc = 2;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-vx")};
+
+    CmdLine cmd(argc, argv);
+
+    Arg verbose(SL('v'));
+
+    cmd.addArg(verbose);
+
+    try {
+        cmd.parse();
+    } catch (const BaseException &x) {
+        REQUIRE(x.desc() == String(SL("Unknown argument \"-x\".")));
+
+        return;
+    }
+
+    REQUIRE(false);
+}
+
+TEST_CASE("TestParseStringList")
+{
+    const StringList args = {SL("-t"), SL("100"), SL("--host=localhost")};
+
+    CmdLine cmd;
+
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+    Arg host(SL('h'), String(SL("host")), true);
+
+    cmd.addArg(timeout);
+    cmd.addArg(host);
+
+    cmd.parse(args);
+
+    REQUIRE(timeout.value() == SL("100"));
+    REQUIRE(host.value() == SL("localhost"));
+}
+
+TEST_CASE("TestFreeze")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("-b")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), false);
+
+    cmd.addArg(a);
+
+    REQUIRE(!cmd.isFrozen());
+
+    cmd.freeze();
+
+    REQUIRE(cmd.isFrozen());
+
+    cmd.addArg(b);
+
+    REQUIRE(!cmd.isFrozen());
+
+    cmd.parse(argc, argv);
+    cmd.parse(argc, argv);
+
+    REQUIRE(cmd.isFrozen());
+    REQUIRE(a.isDefined());
+    REQUIRE(b.isDefined());
+
+    b.setFlag(SL('a'));
+
+    REQUIRE(!cmd.isFrozen());
+    REQUIRE_THROWS_AS(cmd.parse(argc, argv), BaseException);
+    REQUIRE(!cmd.isFrozen());
+
+    b.setFlag(SL('b'));
+
+    cmd.parse(argc, argv);
+
+    REQUIRE(cmd.isFrozen());
+}
+
+TEST_CASE("TestOccurrences")
+{
+    const int argc = 6;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("-b"), SL("100"), SL("add"), SL("-m")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), true);
+    Arg c(SL('c'), String(SL("cc")), false);
+    Command add(SL("add"));
+    MultiArg m(SL('m'), false);
+
+    add.addArg(m);
+    cmd.addArg(a);
+    cmd.addArg(b);
+    cmd.addArg(c);
+    cmd.addArg(add);
+
+    cmd.parse(argc, argv);
+
+    REQUIRE(cmd.occurrences().size() == 4);
+    REQUIRE(cmd.occurrences()[0].m_arg == &a);
+    REQUIRE(cmd.occurrences()[0].m_tokenIndex == 0);
+    REQUIRE(cmd.occurrences()[1].m_arg == &b);
+    REQUIRE(cmd.occurrences()[1].m_tokenIndex == 1);
+    REQUIRE(cmd.occurrences()[2].m_arg == &add);
+    REQUIRE(cmd.occurrences()[2].m_tokenIndex == 3);
+    REQUIRE(cmd.occurrences()[3].m_arg == &m);
+
+    cmd.parse(2, argv);
+
+    REQUIRE(cmd.occurrences().size() == 1);
+    REQUIRE(a.isDefined());
+    REQUIRE(!b.isDefined());
+    REQUIRE(b.value().empty());
+    REQUIRE(!add.isDefined());
+    REQUIRE(!m.isDefined());
+    REQUIRE(!c.isDefined());
+}
+
+TEST_CASE("TestArgvIsCopied")
+{
+    std::unique_ptr<CmdLine> cmd;
+
+    {
+        // Words of argv are destroyed before parsing.
+        const String program(SL("program.exe"));
+        const String name(SL("--timeout"));
+        const String value(SL("100"));
+
+        const CHAR *argv[3] = {program.c_str(), name.c_str(), value.c_str()};
+
+        cmd.reset(new CmdLine(3, argv));
+    }
+
+    Arg timeout(String(SL("timeout")), true);
+
+    cmd->addArg(timeout);
+
+    cmd->parse();
+
+    REQUIRE(timeout.value() == SL("100"));
+
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--timeout"), SL("200")};
+
+    CmdLine borrowing(argc, argv, CmdLine::BorrowArguments);
+
+    Arg borrowed(String(SL("timeout")), true);
+
+    borrowing.addArg(borrowed);
+
+    borrowing.parse();
+
+    REQUIRE(borrowed.value() == SL("200"));
+}
@@ -0,0 +1,138 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <cstdint>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+enum class Mode { Fast, Safe, Debug };
+
+enum class Log : std::uint8_t { Net = 1, Disk = 2, Db = 4 };
+
+ARGS_CHOICES(c_modes,
+             makeChoice(SL("fast"), Mode::Fast),
+             makeChoice(SL("safe"), Mode::Safe),
+             makeChoice(SL("debug"), Mode::Debug))
+
+ARGS_CHOICES(c_logs,
+             makeChoice(SL("net"), Log::Net),
+             makeChoice(SL("disk"), Log::Disk),
+             makeChoice(SL("db"), Log::Db))
+
+constexpr auto c_duplicated = makeChoiceTable(makeChoice(SL("a"), 1), makeChoice(SL("a"), 2));
+static_assert(c_duplicated.error() == ChoiceTableError::NameRedefinition, "Duplicated choice is not found.");
+static_assert(c_duplicated.errorChoice() == 1, "Wrong index of duplicated choice.");
+
+constexpr auto c_empty = makeChoiceTable(makeChoice(SL("a"), 1), makeChoice(SL(""), 2));
+static_assert(c_empty.error() == ChoiceTableError::EmptyName, "Empty choice is not found.");
+
+TEST_CASE("TestChoiceTable")
+{
+    const String debug(SL("debug"));
+    const String deb(SL("deb"));
+
+    REQUIRE(c_modes.size() == 3);
+    REQUIRE(c_modes.indexOf(debug.data(), debug.data() + debug.size()) == 2);
+    REQUIRE(c_modes.indexOf(deb.data(), deb.data() + deb.size()) == -1);
+    REQUIRE(c_modes.choice(2).m_value == Mode::Debug);
+}
+
+TEST_CASE("TestChoiceArg")
+{
+    const int argc = 6;
+    const CHAR *argv[argc] =
+        {SL("program.exe"), SL("--mode=safe"), SL("-l"), SL("net,db"), SL("disk"), SL("--log=net")};
+
+    CmdLine cmd(argc, argv);
+
+    ChoiceArg<Mode> mode(String(SL("mode")), c_modes);
+    ChoiceArg<Mode> def(SL('d'), c_modes);
+    ChoiceSetArg<Log> log(SL('l'), String(SL("log")), c_logs);
+
+    def.setDefaultValue(SL("debug"));
+
+    REQUIRE_THROWS_AS(def.setDefaultValue(SL("slow")), BaseException);
+    REQUIRE(mode.valueSpecifier() == SL("fast|safe|debug"));
+    REQUIRE(log.valueSpecifier() == SL("net|disk|db"));
+
+    cmd.addArg(mode);
+    cmd.addArg(def);
+    cmd.addArg(log);
+
+    cmd.parse();
+
+    REQUIRE(mode.choice() == Mode::Safe);
+    REQUIRE(!def.isDefined());
+    REQUIRE(def.choice() == Mode::Debug);
+    REQUIRE(log.mask() == 7);
+    REQUIRE(log.isChosen(Log::Disk));
+
+    cmd.clear();
+
+    REQUIRE(log.mask() == 0);
+    REQUIRE(!log.isChosen(Log::Net));
+}
+
+TEST_CASE("TestChoiceArgInvalidValue")
+{
+    CmdLine cmd;
+
+    ChoiceArg<Mode> mode(SL('m'), String(SL("mode")), c_modes);
+    ChoiceSetArg<Log> log(SL('l'), String(SL("log")), c_logs);
+
+    log.setDelimiter(SL('+'));
+
+    cmd.addArg(mode);
+    cmd.addArg(log);
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("-l")));
+    args.push_back(String(SL("net+disk")));
+    args.push_back(String(SL("-m")));
+    args.push_back(String(SL("fast")));
+
+    ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+
+    args.back() = String(SL("Fast"));
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &mode);
+    REQUIRE(result.error().message() == SL("Invalid value \"Fast\" of argument \"--mode\"."));
+
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-l"), SL("net,disk")};
+
+    ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::InvalidValue);
+    REQUIRE(error.argument() == &log);
+
+    const CHAR *argv2[argc] = {SL("program.exe"), SL("-m"), SL("debug")};
+
+    error = cmd.tryParse(argc, argv2);
+
+    REQUIRE(!error);
+    REQUIRE(mode.choice() == Mode::Debug);
+}
@@ -506,3 +506,111 @@ TEST_CASE("TestStuff")
 
     REQUIRE(a2.isWithValue());
 }
+
+TEST_CASE("TestNestedScopes")
+{
+    const int argc = 7;
+    const CHAR *argv[argc] = {
+        SL("program.exe"), SL("remote"), SL("-v"), SL("add"), SL("-fn"), SL("origin"), SL("--tags")};
+
+    CmdLine cmd(argc, argv);
+
+    Command remote(SL("remote"));
+    Arg verbose(SL('v'), String(SL("verbose")), false);
+    Command add(SL("add"));
+    Arg fetch(SL('f'));
+    Arg name(SL('n'), String(SL("name")), true);
+    Arg tags(SL("tags"));
+
+    OnlyOneGroup g(SL("group"));
+    g.addArg(tags);
+
+    cmd.addArg(remote);
+    remote.addArg(verbose);
+    remote.addArg(add);
+    add.addArg(fetch);
+    add.addArg(g);
+
+    // Tree is changed after the indices of the scopes were built.
+    REQUIRE(!cmd.findArgument(SL("--name")));
+
+    add.addArg(name);
+
+    cmd.parse();
+
+    REQUIRE(remote.isDefined());
+    REQUIRE(add.isDefined());
+    REQUIRE(verbose.isDefined());
+    REQUIRE(fetch.isDefined());
+    REQUIRE(name.value() == SL("origin"));
+    REQUIRE(tags.isDefined());
+
+    REQUIRE(cmd.findArgument(SL("--name")) == &name);
+    REQUIRE(cmd.findArgument(SL("-v")) == &verbose);
+}
+
+TEST_CASE("TestAbbreviations")
+{
+    const int argc = 5;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--verb"), SL("co"), SL("--am"), SL("msg")};
+
+    CmdLine cmd(argc, argv, CmdLine::AllowAbbreviations);
+
+    Arg verbose(SL('v'), String(SL("verbose")), false);
+    Arg version(String(SL("version")));
+    Command commit(SL("commit"));
+    Command clone(SL("clone"));
+    Arg amend(String(SL("amend")), true);
+
+    cmd.addArg(verbose);
+    cmd.addArg(version);
+    cmd.addArg(commit);
+    cmd.addArg(clone);
+    commit.addArg(amend);
+
+    cmd.parse();
+
+    REQUIRE(verbose.isDefined());
+    REQUIRE(!version.isDefined());
+    REQUIRE(commit.isDefined());
+    REQUIRE(amend.value() == SL("msg"));
+}
+
+TEST_CASE("TestAmbiguousAbbreviation")
+{
+    const int argc = 2;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--ver")};
+
+    CmdLine cmd(argc, argv, CmdLine::AllowAbbreviations);
+
+    Arg verbose(SL('v'), String(SL("verbose")), false);
+    Arg version(String(SL("version")));
+
+    cmd.addArg(verbose);
+    cmd.addArg(version);
+
+    try {
+        cmd.parse();
+    } catch (const BaseException &x) {
+        REQUIRE(x.desc()
+                == String(SL("Ambiguous argument \"--ver\".\n\nProbably you mean \"--verbose or --version\".")));
+
+        return;
+    }
+
+    REQUIRE(false);
+}
+
+TEST_CASE("TestAbbreviationsAreOptIn")
+{
+    const int argc = 2;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--verb")};
+
+    CmdLine cmd(argc, argv);
+
+    Arg verbose(SL('v'), String(SL("verbose")), false);
+
+    cmd.addArg(verbose);
+
+    REQUIRE_THROWS_AS(cmd.parse(), BaseException);
+}
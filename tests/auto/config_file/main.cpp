@@ -0,0 +1,192 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <fstream>
+#include <string>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+//! Write the file with the given content.
+void writeFile(const char *fileName,
+               const std::string &content)
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+    file << content;
+}
+
+TEST_CASE("TestConfigFileEntries")
+{
+    writeFile("entries.ini",
+              "# comment\n"
+              "; comment\n"
+              "\n"
+              "  name =  value with spaces \r\n"
+              "quoted = \" a \"\n"
+              "flag\n"
+              "empty =\n"
+              "-v=1");
+
+    details::ConfigFile file;
+    details::StringView invalid;
+
+    REQUIRE(file.open(String(SL("entries.ini")), invalid));
+    REQUIRE(file.entries().size() == 5);
+    REQUIRE(file.entries()[0].m_key == String(SL("name")));
+    REQUIRE(file.entries()[0].m_value == String(SL("value with spaces")));
+    REQUIRE(file.entries()[1].m_value == String(SL(" a ")));
+    REQUIRE(!file.entries()[2].m_hasValue);
+    REQUIRE(file.entries()[3].m_hasValue);
+    REQUIRE(file.entries()[3].m_value.empty());
+    REQUIRE(file.entries()[4].m_key == String(SL("-v")));
+    REQUIRE(file.entries()[4].m_value == String(SL("1")));
+
+    writeFile("invalid.ini", "a = 1\n[section]\n");
+
+    details::ConfigFile invalidFile;
+
+    REQUIRE(!invalidFile.open(String(SL("invalid.ini")), invalid));
+    REQUIRE(invalid == String(SL("[section]")));
+
+    CmdLine cmd;
+
+    REQUIRE_THROWS_AS(cmd.setConfigFile(String(SL("invalid.ini"))), BaseException);
+    REQUIRE_THROWS_AS(cmd.setConfigFile(String(SL("missing.ini"))), BaseException);
+    REQUIRE(cmd.configFile().empty());
+}
+
+TEST_CASE("TestConfigFilePrecedence")
+{
+    writeFile("layers.ini",
+              "host = file.host\n"
+              "port = 80\n"
+              "port = 8080\n"
+              "tag = a\n"
+              "tag = b\n"
+              "verbose = yes\n"
+              "v\n"
+              "-d = off\n"
+              "level = 3\n");
+
+    const int argc = 5;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--host"), SL("cli.host"), SL("--level"), SL("1")};
+
+    CmdLine cmd(argc, argv);
+
+    Arg host(String(SL("host")), true, true);
+    TypedArg<int> port(String(SL("port")));
+    MultiArg tag(String(SL("tag")), true);
+    MultiArg verbose(SL('v'), String(SL("verbose")), false);
+    Arg debug(SL('d'));
+    MultiArg level(String(SL("level")), true);
+
+    cmd.addArg(host);
+    cmd.addArg(port);
+    cmd.addArg(tag);
+    cmd.addArg(verbose);
+    cmd.addArg(debug);
+    cmd.addArg(level);
+
+    cmd.setConfigFile(String(SL("layers.ini")));
+
+    REQUIRE(cmd.configFile() == SL("layers.ini"));
+
+    cmd.parse();
+
+    REQUIRE(host.value() == SL("cli.host"));
+    REQUIRE(port.typedValue() == 8080);
+    REQUIRE(tag.values().size() == 2);
+    REQUIRE(tag.values().back() == SL("b"));
+    REQUIRE(verbose.count() == 2);
+    REQUIRE(!debug.isDefined());
+    REQUIRE(level.values().size() == 1);
+    REQUIRE(level.values().front() == SL("1"));
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("--tag")));
+    args.push_back(String(SL("c")));
+
+    const ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.value(host) == SL("file.host"));
+    REQUIRE(result.values(tag).size() == 1);
+    REQUIRE(result.values(tag).front() == SL("c"));
+    REQUIRE(result.count(verbose) == 2);
+    REQUIRE(result.values(level).size() == 1);
+    REQUIRE(result.values(level).front() == SL("3"));
+
+    cmd.setConfigFile(String());
+
+    REQUIRE(cmd.configFile().empty());
+}
+
+TEST_CASE("TestConfigFileErrors")
+{
+    writeFile("unknown.ini", "port = 1\nunknown = 2\n");
+    writeFile("bad_value.ini", "port = x\n");
+    writeFile("bad_flag.ini", "d = maybe\n");
+    writeFile("required.ini", "port = 1\n");
+
+    CmdLine cmd;
+
+    TypedArg<int> port(String(SL("port")));
+    Arg debug(SL('d'));
+    Arg name(String(SL("name")), true, true);
+
+    cmd.addArg(port);
+    cmd.addArg(debug);
+    cmd.addArg(name);
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("--name")));
+    args.push_back(String(SL("n")));
+
+    cmd.setConfigFile(String(SL("unknown.ini")));
+
+    ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::UnknownConfigKey);
+    REQUIRE(result.error().message() == SL("Unknown key \"unknown\" in config file \"unknown.ini\"."));
+
+    cmd.setConfigFile(String(SL("bad_value.ini")));
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &port);
+
+    cmd.setConfigFile(String(SL("bad_flag.ini")));
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &debug);
+
+    cmd.setConfigFile(String(SL("required.ini")));
+
+    result = cmd.parseToResult(StringList());
+
+    REQUIRE(result.error().code() == ParseErrorCode::RequiredArgumentNotDefined);
+    REQUIRE(result.error().argument() == &name);
+}
@@ -1,7 +1,7 @@
 
-/*
-    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
-    SPDX-License-Identifier: MIT
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
 */
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
@@ -32,13 +32,9 @@ TEST_CASE("TestContext")
 
     REQUIRE(*ctx.next() == SL("-a"));
 
-    ctx.prepend(SL("value"));
-
-    REQUIRE(*ctx.next() == SL("value"));
-
     ctx.putBack();
 
-    REQUIRE(*ctx.next() == SL("value"));
+    REQUIRE(*ctx.next() == SL("-a"));
     REQUIRE(*ctx.next() == SL("--timeout"));
     REQUIRE(*ctx.next() == SL("100"));
     REQUIRE(*ctx.next() == SL("--port"));
@@ -51,3 +47,141 @@ TEST_CASE("TestContext")
 
     REQUIRE(ctx.atEnd() == true);
 }
+
+TEST_CASE("TestClassifiedContext")
+{
+    ContextInternal internal;
+
+    internal.push_back(SL("--timeout=100"));
+    internal.push_back(SL("value"));
+    internal.push_back(SL("--"));
+
+    Context ctx(std::move(internal));
+
+    REQUIRE(ctx.tag() == details::TokenTag::Unknown);
+    REQUIRE(ctx.splitOffset(*ctx.begin()) == 9);
+
+    ctx.classify([](const String &word, String::size_type splitOffset) {
+        if (word == SL("--")) {
+            return details::TokenTag::Separator;
+        }
+
+        return (splitOffset == String::npos ? details::TokenTag::Value : details::TokenTag::LongOption);
+    });
+
+    REQUIRE(ctx.tag() == details::TokenTag::LongOption);
+    REQUIRE(ctx.tag(1) == details::TokenTag::Value);
+    REQUIRE(ctx.tag(2) == details::TokenTag::Separator);
+    REQUIRE(ctx.tag(3) == details::TokenTag::Unknown);
+
+    REQUIRE(*ctx.next() == SL("--timeout=100"));
+
+    ctx.putBackValue(9);
+
+    REQUIRE(ctx.tag() == details::TokenTag::Unknown);
+    REQUIRE(ctx.tag(1) == details::TokenTag::Value);
+    REQUIRE(*ctx.next() == SL("100"));
+
+    ctx.putBack();
+
+    REQUIRE(ctx.tag() == details::TokenTag::Unknown);
+    REQUIRE(*ctx.next() == SL("100"));
+    REQUIRE(*ctx.next() == SL("value"));
+    REQUIRE(ctx.tag() == details::TokenTag::Separator);
+}
+
+TEST_CASE("TestContextOverViews")
+{
+    const StringList words = {SL("--timeout"), SL("100")};
+
+    ContextView views;
+
+    for (const auto &w : words) {
+        views.push_back(w);
+    }
+
+    Context ctx(std::move(views));
+
+    REQUIRE(ctx.begin()->data() == words.front().data());
+    REQUIRE(*ctx.next() == SL("--timeout"));
+    REQUIRE(ctx.begin()->data() == words.back().data());
+    REQUIRE(*ctx.next() == SL("100"));
+    REQUIRE(ctx.atEnd());
+}
+
+TEST_CASE("TestContextReplace")
+{
+    const StringList words = {SL("--timeout"), SL("100"), SL("-v")};
+    const StringList changed = {SL("200"), SL("--"), SL("-v")};
+
+    ContextView views;
+
+    for (const auto &w : words) {
+        views.push_back(w);
+    }
+
+    Context ctx(std::move(views));
+
+    std::size_t count = 0;
+
+    auto classifier = [&count](const details::StringView &word, String::size_type) {
+        ++count;
+
+        return (word == String(SL("--")) ? details::TokenTag::Separator : details::TokenTag::Value);
+    };
+
+    ctx.classify(classifier);
+
+    REQUIRE(count == 3);
+
+    ctx.next();
+    ctx.next();
+    ctx.next();
+
+    views.clear();
+
+    for (const auto &w : changed) {
+        views.push_back(w);
+    }
+
+    // Only new words are classified.
+    ctx.replace(1, views, classifier);
+
+    REQUIRE(count == 6);
+    REQUIRE(ctx.pos() == 1);
+    REQUIRE(ctx.remaining() == 3);
+    REQUIRE(ctx.tag(1) == details::TokenTag::Separator);
+    REQUIRE(ctx.begin()->data() == changed.front().data());
+    REQUIRE(*ctx.next() == SL("200"));
+
+    ctx.putBack();
+    ctx.putBack();
+
+    REQUIRE(ctx.tag() == details::TokenTag::Value);
+    REQUIRE(*ctx.next() == SL("--timeout"));
+}
+
+TEST_CASE("TestPutBackValue")
+{
+    ContextInternal internal;
+
+    internal.push_back(SL("--define=a=b"));
+    internal.push_back(SL("-v"));
+
+    Context ctx(std::move(internal));
+
+    ctx.classify([](const details::StringView &, String::size_type) {
+        return details::TokenTag::Value;
+    });
+
+    REQUIRE(*ctx.next() == SL("--define=a=b"));
+
+    ctx.putBackValue(8);
+
+    REQUIRE(ctx.tag() == details::TokenTag::Unknown);
+    REQUIRE(ctx.splitOffset(*ctx.begin()) == 1);
+    REQUIRE(*ctx.next() == SL("a=b"));
+    REQUIRE(ctx.tag() == details::TokenTag::Value);
+    REQUIRE(*ctx.next() == SL("-v"));
+    REQUIRE(ctx.atEnd());
+}
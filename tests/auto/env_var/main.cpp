@@ -0,0 +1,190 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+//! Set the environment variable.
+void setEnv(const char *name,
+            const char *value)
+{
+#ifdef _WIN32
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+//! Unset the environment variable.
+void unsetEnv(const char *name)
+{
+#ifdef _WIN32
+    _putenv_s(name, "");
+#else
+    unsetenv(name);
+#endif
+}
+
+TEST_CASE("TestEnvVarPrecedence")
+{
+    setEnv("ARGS_TEST_TIMEOUT", "100");
+    setEnv("ARGS_TEST_HOST", "env.host");
+    setEnv("ARGS_TEST_PORT", "8080");
+    setEnv("ARGS_TEST_DEBUG", "off");
+    setEnv("ARGS_TEST_VERBOSE", "1");
+    unsetEnv("ARGS_TEST_MISSING");
+
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--timeout"), SL("5")};
+
+    CmdLine cmd(argc, argv);
+
+    Arg timeout(String(SL("timeout")), true);
+    timeout.setEnvVar(SL("ARGS_TEST_TIMEOUT"));
+    Arg host(String(SL("host")), true, true);
+    host.setEnvVar(SL("ARGS_TEST_HOST"));
+    TypedArg<int> port(String(SL("port")));
+    port.setEnvVar(SL("ARGS_TEST_PORT"));
+    Arg debug(SL('d'));
+    debug.setEnvVar(SL("ARGS_TEST_DEBUG"));
+    MultiArg verbose(SL('v'));
+    verbose.setEnvVar(SL("ARGS_TEST_VERBOSE"));
+    Arg missing(String(SL("missing")), true);
+    missing.setEnvVar(SL("ARGS_TEST_MISSING"));
+    missing.setDefaultValue(SL("default"));
+
+    cmd.addArg(timeout);
+    cmd.addArg(host);
+    cmd.addArg(port);
+    cmd.addArg(debug);
+    cmd.addArg(verbose);
+    cmd.addArg(missing);
+
+    REQUIRE(host.envVar() == SL("ARGS_TEST_HOST"));
+
+    cmd.parse();
+
+    REQUIRE(timeout.value() == SL("5"));
+    REQUIRE(host.isDefined());
+    REQUIRE(host.value() == SL("env.host"));
+    REQUIRE(port.typedValue() == 8080);
+    REQUIRE(!debug.isDefined());
+    REQUIRE(verbose.count() == 1);
+    REQUIRE(!missing.isDefined());
+    REQUIRE(missing.value() == SL("default"));
+
+    setEnv("ARGS_TEST_HOST", "other.host");
+
+    cmd.freeze();
+
+    const ParseResult result = cmd.parseToResult(StringList());
+
+    REQUIRE(!result.error());
+    REQUIRE(result.value(host) == SL("other.host"));
+    REQUIRE(result.value(timeout) == SL("100"));
+
+    unsetEnv("ARGS_TEST_HOST");
+
+    REQUIRE(cmd.parseToResult(StringList()).error().code() == ParseErrorCode::RequiredArgumentNotDefined);
+}
+
+TEST_CASE("TestEnvVarOverridesConfigFile")
+{
+    {
+        std::ofstream file("env.ini", std::ios::binary | std::ios::trunc);
+
+        file << "host = file.host\nport = 1\n";
+    }
+
+    setEnv("ARGS_TEST_HOST", "env.host");
+    unsetEnv("ARGS_TEST_PORT");
+
+    CmdLine cmd;
+
+    Arg host(String(SL("host")), true);
+    host.setEnvVar(SL("ARGS_TEST_HOST"));
+    Arg port(String(SL("port")), true);
+    port.setEnvVar(SL("ARGS_TEST_PORT"));
+    // Two arguments bound to one variable.
+    Arg server(String(SL("server")), true);
+    server.setEnvVar(SL("ARGS_TEST_HOST"));
+
+    cmd.addArg(host);
+    cmd.addArg(port);
+    cmd.addArg(server);
+    cmd.setConfigFile(String(SL("env.ini")));
+
+    cmd.freeze();
+
+    const ParseResult result = cmd.parseToResult(StringList());
+
+    REQUIRE(!result.error());
+    REQUIRE(result.value(host) == SL("env.host"));
+    REQUIRE(result.value(server) == SL("env.host"));
+    REQUIRE(result.value(port) == SL("1"));
+}
+
+TEST_CASE("TestEnvVarInCommand")
+{
+    setEnv("ARGS_TEST_NAME", "env.name");
+    setEnv("ARGS_TEST_PORT", "x");
+
+    CmdLine cmd;
+
+    Command add(SL("add"));
+    Arg name(String(SL("name")), true, true);
+    name.setEnvVar(SL("ARGS_TEST_NAME"));
+    Command del(SL("delete"));
+
+    add.addArg(name);
+    cmd.addArg(add);
+    cmd.addArg(del);
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("add")));
+
+    ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.value(name) == SL("env.name"));
+
+    args.clear();
+    args.push_back(String(SL("delete")));
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+    REQUIRE(!result.isDefined(name));
+
+    TypedArg<int> port(String(SL("port")));
+    port.setEnvVar(SL("ARGS_TEST_PORT"));
+
+    cmd.addArg(port);
+    cmd.freeze();
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &port);
+}
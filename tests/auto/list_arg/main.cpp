@@ -0,0 +1,147 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <cstdint>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+TEST_CASE("TestListArg")
+{
+    const int argc = 9;
+    const CHAR *argv[argc] = {SL("program.exe"),
+                              SL("--ids"),
+                              SL("1,2,3"),
+                              SL("4"),
+                              SL("-w"),
+                              SL("0.5;-1e2"),
+                              SL("--ids=-5,6"),
+                              SL("-v"),
+                              SL("7")};
+
+    CmdLine cmd(argc, argv, CmdLine::HandlePositionalArguments);
+
+    ListArg<std::int32_t> ids(String(SL("ids")));
+    ListArg<double> weights(SL('w'), String(SL("weights")));
+    ListArg<unsigned int> def(SL('d'));
+    Arg v(SL('v'));
+
+    weights.setDelimiter(SL(';'));
+    def.setDefaultValue(SL("10,20"));
+
+    REQUIRE_THROWS_AS(def.setDefaultValue(SL("30,x")), BaseException);
+
+    cmd.addArg(ids);
+    cmd.addArg(weights);
+    cmd.addArg(def);
+    cmd.addArg(v);
+
+    cmd.parse();
+
+    REQUIRE(ids.typedValues() == std::vector<std::int32_t>({1, 2, 3, 4, -5, 6}));
+    REQUIRE(ids.count() == 6);
+    REQUIRE(weights.typedValues() == std::vector<double>({0.5, -100.0}));
+    REQUIRE(!def.isDefined());
+    REQUIRE(def.typedValues() == std::vector<unsigned int>({10, 20}));
+    REQUIRE(v.isDefined());
+    REQUIRE(cmd.positional().size() == 1);
+
+    cmd.clear();
+
+    REQUIRE(ids.typedValues().empty());
+}
+
+TEST_CASE("TestListArgErrors")
+{
+    CmdLine cmd;
+
+    ListArg<int> ids(SL('i'), String(SL("ids")));
+    Arg v(SL('v'));
+
+    cmd.addArg(ids);
+    cmd.addArg(v);
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("-i")));
+    args.push_back(String(SL("1,2")));
+    args.push_back(String(SL("3,,4")));
+
+    ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &ids);
+    REQUIRE(result.error().message() == SL("Invalid value \"3,,4\" of argument \"--ids\"."));
+
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-i"), SL("1,x")};
+
+    ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::InvalidValue);
+    REQUIRE(error.argument() == &ids);
+
+    const CHAR *argv2[argc] = {SL("program.exe"), SL("-i"), SL("-v")};
+
+    error = cmd.tryParse(argc, argv2);
+
+    REQUIRE(error.code() == ParseErrorCode::ValueRequired);
+}
+
+TEST_CASE("TestListArgMany")
+{
+    String line;
+    std::vector<std::int64_t> expected;
+
+    for (std::int64_t i = 0; i < 100000; ++i) {
+        const std::int64_t v = (i % 2 ? -i * 1000003 : i);
+
+        if (i) {
+            line.push_back(SL(','));
+        }
+
+        String digits;
+
+        for (std::int64_t a = (v < 0 ? -v : v); a || digits.empty(); a /= 10) {
+            digits.insert(digits.begin(), static_cast<Char>(SL('0') + a % 10));
+        }
+
+        if (v < 0) {
+            line.push_back(SL('-'));
+        }
+
+        line += digits;
+
+        expected.push_back(v);
+    }
+
+    CmdLine cmd;
+
+    ListArg<std::int64_t> ids(String(SL("ids")));
+
+    cmd.addArg(ids);
+
+    StringList args;
+    args.push_back(String(SL("--ids")));
+    args.push_back(line);
+
+    cmd.parse(args);
+
+    REQUIRE(ids.typedValues() == expected);
+}
@@ -1,7 +1,7 @@
 
-/*
-    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
-    SPDX-License-Identifier: MIT
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
 */
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
@@ -286,3 +286,136 @@ TEST_CASE("TestStuff")
     REQUIRE(multi.values().size() == 1);
     REQUIRE(multi.values().front() == SL("2"));
 }
+
+TEST_CASE("TestValuesUntilKnownArgument")
+{
+    const int argc = 8;
+    const CHAR *argv[argc] = {SL("program.exe"),
+                              SL("-m"),
+                              SL("100"),
+                              SL("200"),
+                              SL("--unknown"),
+                              SL("--timeout=10"),
+                              SL("-vd"),
+                              SL("--")};
+
+    CmdLine cmd(argc, argv, CmdLine::HandlePositionalArguments);
+
+    MultiArg multi(SL('m'), String(SL("multi")), true);
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+    Arg verbose(SL('v'));
+    Arg debug(SL('d'));
+
+    cmd.addArg(multi);
+    cmd.addArg(timeout);
+    cmd.addArg(verbose);
+    cmd.addArg(debug);
+
+    cmd.parse();
+
+    REQUIRE(multi.values().size() == 3);
+    REQUIRE(multi.values().back() == SL("--unknown"));
+    REQUIRE(timeout.value() == SL("10"));
+    REQUIRE(verbose.isDefined());
+    REQUIRE(debug.isDefined());
+    REQUIRE(cmd.positional().empty());
+}
+
+TEST_CASE("TestBorrowAndTakeValues")
+{
+    const int argc = 6;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-m"), SL("100"), SL("200"), SL("-t"), SL("10")};
+
+    CmdLine cmd(argc, argv);
+
+    MultiArg multi(SL('m'), String(SL("multi")), true);
+    multi.setDefaultValue(SL("default"));
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+
+    cmd.addArg(multi);
+    cmd.addArg(timeout);
+
+    cmd.parse();
+
+    REQUIRE(&cmd.value(SL("-m")) == &multi.values().front());
+    REQUIRE(cmd.value(SL("--unknown")).empty());
+
+    const ValuesView view = cmd.valuesView(SL("-m"));
+
+    REQUIRE(view.size() == 2);
+    REQUIRE(&view.front() == &multi.values().front());
+
+    StringList copy(view.begin(), view.end());
+
+    REQUIRE(copy == multi.values());
+
+    const ValuesView single = cmd.valuesView(SL("-t"));
+
+    REQUIRE(single.size() == 1);
+    REQUIRE(&*single.begin() == &timeout.value());
+    REQUIRE(std::next(single.begin()) == single.end());
+
+    REQUIRE(cmd.valuesView(SL("--unknown")).empty());
+
+    const StringList taken = cmd.takeValues(SL("--multi"));
+
+    REQUIRE(taken.size() == 2);
+    REQUIRE(taken.back() == SL("200"));
+    REQUIRE(multi.values().size() == 1);
+    REQUIRE(multi.values().front() == SL("default"));
+}
+
+TEST_CASE("TestValuesUntilKnownFlagInScope")
+{
+    CmdLine cmd;
+
+    MultiArg multi(SL('m'), String(SL("multi")), true);
+    Arg verbose(SL('v'));
+    Command add(SL("add"));
+    Arg force(SL('f'));
+
+    add.addArg(force);
+
+    cmd.addArg(multi);
+    cmd.addArg(verbose);
+    cmd.addArg(add);
+
+    cmd.freeze();
+
+    // "-f" isn't in the scope without "add", so "-vf" is a value.
+    StringList args;
+    args.push_back(String(SL("-m")));
+    args.push_back(String(SL("1")));
+    args.push_back(String(SL("-vf")));
+    args.push_back(String(SL("-v")));
+
+    ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.values(multi).size() == 2);
+    REQUIRE(*++result.values(multi).begin() == SL("-vf"));
+    REQUIRE(result.isDefined(verbose));
+
+    // In the scope of "add" "-vf" and "--multi=2" aren't values.
+    args.clear();
+    args.push_back(String(SL("add")));
+    args.push_back(String(SL("-m")));
+    args.push_back(String(SL("1")));
+    args.push_back(String(SL("-vf")));
+    args.push_back(String(SL("--multi=2")));
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.values(multi).size() == 2);
+    REQUIRE(*++result.values(multi).begin() == SL("2"));
+    REQUIRE(result.isDefined(verbose));
+    REQUIRE(result.isDefined(force));
+
+    cmd.parse(args);
+
+    REQUIRE(multi.values().size() == 2);
+    REQUIRE(multi.values().front() == SL("1"));
+    REQUIRE(verbose.isDefined());
+    REQUIRE(force.isDefined());
+}
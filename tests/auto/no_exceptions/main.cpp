@@ -0,0 +1,313 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+#include <args-parser/static_schema.hpp>
+
+#ifdef ARGS_QSTRING_BUILD
+#include <QString>
+#include <QTextStream>
+#else
+#include <sstream>
+#endif
+
+namespace Args
+{
+
+#ifdef ARGS_WSTRING_BUILD
+std::wstringstream g_argsOutStream;
+#elif defined(ARGS_QSTRING_BUILD)
+QString g_string;
+QTextStream g_argsOutStream(&g_string);
+#else
+std::stringstream g_argsOutStream;
+#endif
+
+} /* namespace Args */
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+TEST_CASE("TestTryParseOk")
+{
+    const int argc = 4;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("--bb=100"), SL("-c")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), true);
+    Arg c(SL('c'), String(SL("cc")), false);
+
+    cmd.addArg(a);
+    cmd.addArg(b);
+    cmd.addArg(c);
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(!error);
+    REQUIRE(error.code() == ParseErrorCode::NoError);
+    REQUIRE(error.message().empty());
+    REQUIRE(a.isDefined());
+    REQUIRE(b.value() == SL("100"));
+    REQUIRE(c.isDefined());
+}
+
+TEST_CASE("TestTryParseUnknownArgument")
+{
+    const int argc = 4;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("--bb=100"), SL("--ac")};
+
+    CmdLine cmd;
+
+    cmd.addArgWithFlagAndName(SL('a'), SL("ca"), false).addArgWithFlagAndName(SL('b'), SL("bb"), true);
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error);
+    REQUIRE(error.code() == ParseErrorCode::UnknownArgument);
+    REQUIRE(error.tokenIndex() == 2);
+    REQUIRE(error.word() == SL("--ac"));
+    REQUIRE(error.message() == SL("Unknown argument \"--ac\".\n\nProbably you mean \"--ca\"."));
+}
+
+TEST_CASE("TestTryParseFlags")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("-ax")};
+
+    CmdLine cmd;
+
+    cmd.addArgWithFlagOnly(SL('a')).addArgWithFlagOnly(SL('b'), true);
+
+    ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::UnknownFlag);
+    REQUIRE(error.tokenIndex() == 1);
+    REQUIRE(error.word() == SL("x"));
+    REQUIRE(error.message() == SL("Unknown argument \"-x\"."));
+
+    const CHAR *argv2[argc] = {SL("program.exe"), SL("-ba"), SL("value")};
+
+    error = cmd.tryParse(argc, argv2);
+
+    REQUIRE(error.code() == ParseErrorCode::FlagsComboWithValue);
+    REQUIRE(error.tokenIndex() == 0);
+    REQUIRE(error.argument() == cmd.findArgument(SL("-b")));
+    REQUIRE(error.message() == SL("Only last argument in flags combo can be with value. Flags combo is \"-ba\"."));
+}
+
+TEST_CASE("TestTryParseValues")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-b"), SL("-a")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), true);
+
+    cmd.addArg(a);
+    cmd.addArg(b);
+
+    ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::ValueRequired);
+    REQUIRE(error.tokenIndex() == 0);
+    REQUIRE(error.argument() == &b);
+    REQUIRE(error.message() == SL("Argument \"--bb\" requires value that wasn't presented."));
+
+    const CHAR *argv2[argc] = {SL("program.exe"), SL("-a"), SL("--aa")};
+
+    error = cmd.tryParse(argc, argv2);
+
+    REQUIRE(error.code() == ParseErrorCode::AlreadyDefined);
+    REQUIRE(error.tokenIndex() == 1);
+    REQUIRE(error.argument() == &a);
+    REQUIRE(error.message() == SL("Argument \"--aa\" already defined."));
+}
+
+TEST_CASE("TestTryParseCommands")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("add"), SL("delete")};
+
+    CmdLine cmd(CmdLine::CommandIsRequired);
+
+    Command add(SL("add"));
+    Command del(SL("delete"));
+
+    cmd.addArg(add);
+    cmd.addArg(del);
+
+    ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::OnlyOneCommand);
+    REQUIRE(error.tokenIndex() == 1);
+    REQUIRE(error.argument() == &del);
+    REQUIRE(error.otherArgument() == &add);
+    REQUIRE(error.message()
+            == SL("Only one command from one level can be specified. "
+                  "But you defined \"delete\" and \"add\"."));
+
+    error = cmd.tryParse(1, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::CommandNotSpecified);
+    REQUIRE(error.tokenIndex() == ParseError::c_noToken);
+    REQUIRE(error.message() == SL("Not specified command."));
+}
+
+TEST_CASE("TestTryParseAfterParsing")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("-b")};
+
+    CmdLine cmd;
+
+    OnlyOneGroup group(SL("group"));
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), false);
+    Arg c(SL('c'), String(SL("cc")), false, true);
+
+    group.addArg(a);
+    group.addArg(b);
+    cmd.addArg(group);
+    cmd.addArg(c);
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::OnlyOneGroupViolated);
+    REQUIRE(error.tokenIndex() == ParseError::c_noToken);
+    REQUIRE(error.group() == &group);
+    REQUIRE(error.argument() == &b);
+    REQUIRE(error.otherArgument() == &a);
+    REQUIRE(error.message()
+            == SL("Only one argument can be defined in OnlyOne group \"group\". "
+                  "Whereas defined \"--aa\" and \"--bb\"."));
+}
+
+TEST_CASE("TestTryParseAmbiguous")
+{
+    const int argc = 2;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--ver")};
+
+    CmdLine cmd(CmdLine::AllowAbbreviations);
+
+    cmd.addArgWithNameOnly(SL("verbose")).addArgWithNameOnly(SL("version"));
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::AmbiguousArgument);
+    REQUIRE(error.tokenIndex() == 0);
+    REQUIRE(error.message() == SL("Ambiguous argument \"--ver\".\n\nProbably you mean \"--verbose or --version\"."));
+}
+
+TEST_CASE("TestTryParseHelp")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-h"), SL("-a")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false);
+
+    cmd.addArg(a);
+    cmd.addHelp(true, argv[0], SL("Test."));
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::HelpPrinted);
+    REQUIRE(error.message() == SL("Help has been printed."));
+}
+
+ARGS_STATIC_SCHEMA(c_schema,
+                   StaticArg(SL('t'), SL("timeout"), true),
+                   StaticArg(SL('v'), SL("verbose")),
+                   StaticArg(SL("host"), true, true),
+                   StaticMultiArg(SL('f'), SL("file"), true))
+
+TEST_CASE("TestStaticSchemaTryParse")
+{
+    StaticParseResult<c_schema.size()> result(c_schema);
+
+    {
+        const int argc = 5;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("--host"), SL("h"), SL("-f"), SL("a")};
+
+        REQUIRE(!c_schema.tryParse(argc, argv, result));
+        REQUIRE(result.value(SL("--host")) == SL("h"));
+        REQUIRE(result.values(SL("-f")).size() == 1);
+    }
+
+    {
+        const int argc = 3;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-v"), SL("--unknown")};
+
+        const ParseError error = c_schema.tryParse(argc, argv, result);
+
+        REQUIRE(error.code() == ParseErrorCode::UnknownArgument);
+        REQUIRE(error.tokenIndex() == 1);
+        REQUIRE(error.message() == SL("Unknown argument \"--unknown\"."));
+        REQUIRE(!result.isDefined(SL("-f")));
+    }
+
+    {
+        const int argc = 3;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-v"), SL("-t")};
+
+        const ParseError error = c_schema.tryParse(argc, argv, result);
+
+        REQUIRE(error.code() == ParseErrorCode::ValueRequired);
+        REQUIRE(error.tokenIndex() == 1);
+        REQUIRE(error.argumentIndex() == 0);
+        REQUIRE(error.staticArgument() == &c_schema.argument(0));
+        REQUIRE(error.message() == SL("Argument \"--timeout\" requires value that wasn't presented."));
+    }
+
+    {
+        const int argc = 3;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-v"), SL("--verbose")};
+
+        const ParseError error = c_schema.tryParse(argc, argv, result);
+
+        REQUIRE(error.code() == ParseErrorCode::AlreadyDefined);
+        REQUIRE(error.tokenIndex() == 1);
+        REQUIRE(error.argumentIndex() == 1);
+        REQUIRE(error.message() == SL("Argument \"--verbose\" already defined."));
+    }
+
+    {
+        const int argc = 2;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-vx")};
+
+        const ParseError error = c_schema.tryParse(argc, argv, result);
+
+        REQUIRE(error.code() == ParseErrorCode::UnknownFlag);
+        REQUIRE(error.argumentIndex() == ParseError::c_noArgument);
+        REQUIRE(error.message() == SL("Unknown argument \"-x\"."));
+    }
+
+    {
+        const int argc = 2;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-v")};
+
+        const ParseError error = c_schema.tryParse(argc, argv, result);
+
+        REQUIRE(error.code() == ParseErrorCode::RequiredArgumentNotDefined);
+        REQUIRE(error.tokenIndex() == ParseError::c_noToken);
+        REQUIRE(error.argumentIndex() == 2);
+        REQUIRE(error.message() == SL("Undefined required argument \"--host\"."));
+    }
+}
@@ -0,0 +1,198 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+//! File opened for reading with the file descriptor.
+class File final
+{
+public:
+    //! Write the file with the given content and open it.
+    File(const char *fileName,
+         const std::string &content)
+    {
+        {
+            std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+            file << content;
+        }
+
+        m_file = std::fopen(fileName, "rb");
+    }
+
+    ~File()
+    {
+        if (m_file) {
+            std::fclose(m_file);
+        }
+    }
+
+    //! \return File descriptor.
+    int fd() const
+    {
+#ifdef _WIN32
+        return _fileno(m_file);
+#else
+        return fileno(m_file);
+#endif
+    }
+
+private:
+    //! File.
+    std::FILE *m_file;
+}; // class File
+
+//! Sink that counts positional arguments.
+class Counter final : public PositionalSinkIface
+{
+public:
+    void positional(String &&word) override
+    {
+        m_last = std::move(word);
+        ++m_count;
+    }
+
+    std::size_t m_count = 0;
+    String m_last;
+}; // class Counter
+
+TEST_CASE("TestNulStreamChunks")
+{
+    const std::string content("first\0second\0\0a-long-word\0last", 30);
+
+    File file("chunks.bin", content);
+
+    REQUIRE(file.fd() >= 0);
+
+    // Chunk is smaller than words, so they are cut.
+    details::NulStream stream(file.fd(), 3);
+    ContextView words;
+
+    while (stream.read(words)) {
+    }
+
+    REQUIRE(stream.atEnd());
+    REQUIRE(!stream.isFailed());
+    REQUIRE(words.size() == 5);
+    REQUIRE(words[0] == String(SL("first")));
+    REQUIRE(words[1] == String(SL("second")));
+    REQUIRE(words[2].empty());
+    REQUIRE(words[3] == String(SL("a-long-word")));
+    REQUIRE(words[4] == String(SL("last")));
+}
+
+TEST_CASE("TestParseStream")
+{
+    const std::string content("-v\0--name\0n\0a\0b\0", 16);
+
+    File file("args.bin", content);
+
+    CmdLine cmd(CmdLine::HandlePositionalArguments);
+
+    Arg v(SL('v'));
+    Arg name(String(SL("name")), true);
+
+    cmd.addArg(v);
+    cmd.addArg(name);
+
+    cmd.parseStream(file.fd());
+
+    REQUIRE(v.isDefined());
+    REQUIRE(name.value() == SL("n"));
+    REQUIRE(cmd.positional().size() == 2);
+    REQUIRE(cmd.positional().back() == SL("b"));
+
+    CmdLine loose(CmdLine::HandlePositionalArguments);
+
+    loose.addArg(v);
+
+    // "-x" starts positional arguments.
+    File positional("positional.bin", std::string("-x\0-v", 5));
+
+    loose.parseStream(positional.fd());
+
+    REQUIRE(!v.isDefined());
+    REQUIRE(loose.positional().size() == 2);
+    REQUIRE(loose.positional().back() == SL("-v"));
+
+    CmdLine strict;
+
+    strict.addArg(v);
+
+    File unknown("unknown.bin", std::string("-v\0--unknown", 12));
+
+    const ParseError error = strict.tryParseStream(unknown.fd());
+
+    REQUIRE(error.code() == ParseErrorCode::UnknownArgument);
+    REQUIRE(error.tokenIndex() == 1);
+
+    REQUIRE(strict.tryParseStream(-1).code() == ParseErrorCode::Other);
+}
+
+TEST_CASE("TestParseLargeStream")
+{
+    const std::size_t count = 200000;
+
+    std::string content;
+
+    // Values of the argument are split between the chunks.
+    for (std::size_t i = 0; i < count; ++i) {
+        content.append("--tag\0", 6);
+        content.append(std::to_string(i));
+        content.push_back('\0');
+    }
+
+    content.append("-v\0--name\0n\0--\0", 15);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        content.append("word");
+        content.append(std::to_string(i));
+        content.push_back('\0');
+    }
+
+    File file("large.bin", content);
+
+    CmdLine cmd(CmdLine::HandlePositionalArguments);
+
+    Arg v(SL('v'));
+    Arg name(String(SL("name")), true);
+    MultiArg tag(String(SL("tag")), true);
+
+    Counter counter;
+
+    cmd.addArg(v);
+    cmd.addArg(name);
+    cmd.addArg(tag);
+    cmd.setPositionalSink(&counter);
+
+    cmd.parseStream(file.fd());
+
+    REQUIRE(v.isDefined());
+    REQUIRE(name.value() == SL("n"));
+    REQUIRE(tag.count() == count);
+    REQUIRE(tag.values().back() == SL("199999"));
+    REQUIRE(cmd.positional().empty());
+    REQUIRE(counter.m_count == count);
+    REQUIRE(counter.m_last == SL("word199999"));
+}
@@ -0,0 +1,156 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+//! Handler that records events.
+class Recorder final : public ParseHandlerIface
+{
+public:
+    void argument(const ArgIface &arg) override
+    {
+        m_events.push_back(String(SL("arg ")) + arg.name());
+    }
+
+    void command(const Command &cmd) override
+    {
+        m_events.push_back(String(SL("cmd ")) + cmd.name());
+    }
+
+    void value(const ArgIface &arg,
+               const String &value) override
+    {
+        m_events.push_back(arg.name() + SL(" = ") + value);
+    }
+
+    void positional(const String &word) override
+    {
+        m_events.push_back(String(SL("pos ")) + word);
+    }
+
+    StringList m_events;
+}; // class Recorder
+
+TEST_CASE("TestParseToHandler")
+{
+    const int argc = 10;
+    const CHAR *argv[argc] = {SL("program.exe"),
+                              SL("add"),
+                              SL("-v"),
+                              SL("--file=a.txt"),
+                              SL("-m"),
+                              SL("1"),
+                              SL("2"),
+                              SL("-vv"),
+                              SL("--"),
+                              SL("rest")};
+
+    CmdLine cmd(CmdLine::HandlePositionalArguments);
+
+    Command add(SL("add"));
+    MultiArg v(SL('v'), String(SL("verbose")), false);
+    Arg file(String(SL("file")), true, true);
+    MultiArg m(SL('m'), true);
+
+    add.addArg(v);
+    add.addArg(file);
+    add.addArg(m);
+    cmd.addArg(add);
+
+    cmd.freeze();
+
+    Recorder recorder;
+
+    const ParseResult result = cmd.parseToHandler(argc, argv, recorder);
+
+    StringList expected;
+    expected.push_back(String(SL("cmd add")));
+    expected.push_back(String(SL("arg --verbose")));
+    expected.push_back(String(SL("arg --file")));
+    expected.push_back(String(SL("--file = a.txt")));
+    expected.push_back(String(SL("arg -m")));
+    expected.push_back(String(SL("-m = 1")));
+    expected.push_back(String(SL("-m = 2")));
+    expected.push_back(String(SL("arg --verbose")));
+    expected.push_back(String(SL("arg --verbose")));
+    expected.push_back(String(SL("pos rest")));
+
+    REQUIRE(!result.error());
+    REQUIRE(recorder.m_events == expected);
+    REQUIRE(result.command() == &add);
+    REQUIRE(result.isDefined(file));
+    REQUIRE(result.values(m).empty());
+    REQUIRE(result.count(v) == 3);
+    REQUIRE(result.positional().empty());
+    REQUIRE(!file.isDefined());
+    REQUIRE(m.values().empty());
+}
+
+TEST_CASE("TestParseToHandlerChecks")
+{
+    CmdLine cmd;
+
+    OnlyOneGroup group(SL("group"));
+    Arg a(SL('a'));
+    Arg b(SL('b'));
+    Arg c(SL('c'), String(SL("cc")), true, true);
+    TypedMultiArg<int> i(SL('i'));
+
+    group.addArg(a);
+    group.addArg(b);
+    cmd.addArg(group);
+    cmd.addArg(c);
+    cmd.addArg(i);
+
+    cmd.freeze();
+
+    Recorder recorder;
+
+    StringList args;
+    args.push_back(String(SL("-a")));
+
+    ParseResult result = cmd.parseToHandler(args, recorder);
+
+    REQUIRE(result.error().code() == ParseErrorCode::RequiredArgumentNotDefined);
+    REQUIRE(result.error().argument() == &c);
+
+    args.push_back(String(SL("-c")));
+    args.push_back(String(SL("x")));
+    args.push_back(String(SL("-b")));
+
+    result = cmd.parseToHandler(args, recorder);
+
+    REQUIRE(result.error().code() == ParseErrorCode::OnlyOneGroupViolated);
+
+    recorder.m_events.clear();
+
+    args.clear();
+    args.push_back(String(SL("-c")));
+    args.push_back(String(SL("x")));
+    args.push_back(String(SL("-i")));
+    args.push_back(String(SL("1")));
+    args.push_back(String(SL("one")));
+    args.push_back(String(SL("2")));
+
+    result = cmd.parseToHandler(args, recorder);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &i);
+    REQUIRE(recorder.m_events.size() == 4);
+    REQUIRE(recorder.m_events.back() == SL("-i = 1"));
+}
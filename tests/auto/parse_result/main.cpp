@@ -0,0 +1,293 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+#include <args-parser/batch.hpp>
+
+// C++ include.
+#include <thread>
+#include <vector>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+TEST_CASE("TestParseToResult")
+{
+    const int argc = 7;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("--bb=100"), SL("-m"), SL("1"), SL("2"), SL("-cc")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), true);
+    Arg d(SL('d'), String(SL("dd")), true);
+    MultiArg m(SL('m'), String(SL("mm")), true);
+    MultiArg c(SL('c'), false);
+
+    d.setDefaultValue(SL("default"));
+
+    cmd.addArg(a);
+    cmd.addArg(b);
+    cmd.addArg(d);
+    cmd.addArg(m);
+    cmd.addArg(c);
+
+    cmd.freeze();
+
+    const ParseResult result = cmd.parseToResult(argc, argv);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.isDefined(a));
+    REQUIRE(result.isDefined(SL("--aa")));
+    REQUIRE(result.value(b) == SL("100"));
+    REQUIRE(!result.isDefined(d));
+    REQUIRE(result.value(SL("-d")) == SL("default"));
+    REQUIRE(result.values(m).size() == 2);
+    REQUIRE(result.values(SL("--mm")).front() == SL("1"));
+    REQUIRE(result.count(c) == 2);
+    REQUIRE(!result.isDefined(SL("--unknown")));
+
+    REQUIRE(!a.isDefined());
+    REQUIRE(b.value().empty());
+    REQUIRE(m.count() == 0);
+    REQUIRE(c.count() == 0);
+}
+
+TEST_CASE("TestParseToResultCommands")
+{
+    const int argc = 5;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("add"), SL("file"), SL("-v"), SL("text")};
+
+    CmdLine cmd(CmdLine::CommandIsRequired | CmdLine::HandlePositionalArguments);
+
+    Command add(SL("add"), ValueOptions::NoValue, true);
+    Command file(SL("file"));
+    Command del(SL("delete"));
+    Arg v(SL('v'), String(SL("verbose")), false);
+
+    file.addArg(v);
+    add.addArg(file);
+    cmd.addArg(add);
+    cmd.addArg(del);
+
+    cmd.freeze();
+
+    ParseResult result = cmd.parseToResult(argc, argv);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.command() == &add);
+    REQUIRE(result.subCommand(add) == &file);
+    REQUIRE(result.subCommand(file) == nullptr);
+    REQUIRE(result.isDefined(v));
+    REQUIRE(result.isDefined(SL("file")));
+    REQUIRE(result.positional().size() == 1);
+    REQUIRE(result.positional().front() == SL("text"));
+    REQUIRE(result.occurrences().size() == 3);
+    REQUIRE(result.occurrences()[1].m_arg == &file);
+    REQUIRE(result.occurrences()[2].m_tokenIndex == 2);
+    REQUIRE(!add.isDefined());
+
+    result = cmd.parseToResult(2, argv);
+
+    REQUIRE(result.error().code() == ParseErrorCode::RequiredSubCommandNotDefined);
+    REQUIRE(result.error().argument() == &add);
+    REQUIRE(result.error().message() == SL("Wasn't defined required sub-command of command \"add\"."));
+
+    result = cmd.parseToResult(1, argv);
+
+    REQUIRE(result.error().code() == ParseErrorCode::CommandNotSpecified);
+}
+
+TEST_CASE("TestParseToResultErrors")
+{
+    const int argc = 4;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-a"), SL("-b"), SL("--ac")};
+
+    CmdLine cmd;
+
+    OnlyOneGroup group(SL("group"));
+    Arg a(SL('a'), String(SL("ca")), false);
+    Arg b(SL('b'), String(SL("bb")), false);
+    Arg c(SL('c'), String(SL("cc")), true, true);
+
+    group.addArg(a);
+    group.addArg(b);
+    cmd.addArg(group);
+    cmd.addArg(c);
+
+    REQUIRE_THROWS_AS(cmd.parseToResult(argc, argv), BaseException);
+
+    cmd.freeze();
+
+    ParseResult result = cmd.parseToResult(argc, argv);
+
+    REQUIRE(result.error().code() == ParseErrorCode::UnknownArgument);
+    REQUIRE(result.error().tokenIndex() == 2);
+    REQUIRE(result.error().message() == SL("Unknown argument \"--ac\".\n\nProbably you mean \"--ca\"."));
+
+    result = cmd.parseToResult(2, argv);
+
+    REQUIRE(result.error().code() == ParseErrorCode::RequiredArgumentNotDefined);
+    REQUIRE(result.error().argument() == &c);
+
+    const CHAR *argv2[argc] = {SL("program.exe"), SL("-a"), SL("-b"), SL("-c")};
+
+    result = cmd.parseToResult(argc, argv2);
+
+    REQUIRE(result.error().code() == ParseErrorCode::ValueRequired);
+    REQUIRE(result.error().argument() == &c);
+
+    const CHAR *argv3[argc] = {SL("program.exe"), SL("-a"), SL("-b"), SL("-c=1")};
+
+    result = cmd.parseToResult(argc, argv3);
+
+    REQUIRE(result.error().code() == ParseErrorCode::OnlyOneGroupViolated);
+    REQUIRE(result.error().group() == &group);
+    REQUIRE(result.isDefined(group));
+
+    const CHAR *argv4[argc] = {SL("program.exe"), SL("-a"), SL("-c=1"), SL("-a")};
+
+    result = cmd.parseToResult(argc, argv4);
+
+    REQUIRE(result.error().code() == ParseErrorCode::AlreadyDefined);
+    REQUIRE(result.error().tokenIndex() == 2);
+}
+
+TEST_CASE("TestParseToResultHelp")
+{
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-h"), SL("-a")};
+
+    CmdLine cmd;
+
+    Arg a(SL('a'), String(SL("aa")), false, true);
+
+    cmd.addArg(a);
+    cmd.addHelp(true, argv[0], SL("Test."));
+
+    cmd.freeze();
+
+    const ParseResult result = cmd.parseToResult(argc, argv);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.isDefined(SL("--help")));
+    REQUIRE(result.value(SL("-h")) == SL("-a"));
+    REQUIRE(!result.isDefined(a));
+}
+
+TEST_CASE("TestParseToResultThreads")
+{
+    CmdLine cmd(CmdLine::AllowAbbreviations);
+
+    Command add(SL("add"), ValueOptions::ManyValues);
+    Arg verbose(SL('v'), String(SL("verbose")), false);
+    Arg timeout(SL('t'), String(SL("timeout")), true);
+
+    cmd.addArg(add);
+    cmd.addArg(verbose);
+    cmd.addArg(timeout);
+
+    cmd.freeze();
+
+    const std::size_t threadsCount = 4;
+    const std::size_t parsingsCount = 200;
+
+    std::vector<std::size_t> failed(threadsCount, 0);
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&cmd, &failed, t]() {
+            const String timeout = String(1, static_cast<Char>(SL('0') + t));
+
+            StringList args;
+            args.push_back(String(SL("--verb")));
+            args.push_back(String(SL("--timeout=")) + timeout);
+            args.push_back(String(SL("add")));
+            args.push_back(String(SL("file")));
+            args.push_back(timeout);
+
+            for (std::size_t i = 0; i < parsingsCount; ++i) {
+                const ParseResult result = cmd.parseToResult(args);
+
+                if (result.error() || !result.isDefined(SL("-v")) || result.value(SL("--timeout")) != timeout
+                    || result.values(SL("add")).size() != 2 || result.value(SL("add")) != SL("file")) {
+                    ++failed[t];
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < threadsCount; ++t) {
+        REQUIRE(failed[t] == 0);
+    }
+
+    REQUIRE(!verbose.isDefined());
+    REQUIRE(!add.isDefined());
+}
+
+TEST_CASE("TestParseBatch")
+{
+    CmdLine cmd;
+
+    Arg verbose(SL('v'), String(SL("verbose")), false);
+    Arg timeout(SL('t'), String(SL("timeout")), true, true);
+
+    cmd.addArg(verbose);
+    cmd.addArg(timeout);
+
+    std::vector<StringList> lines;
+
+    REQUIRE_THROWS_AS(parseBatch(cmd, lines), BaseException);
+
+    cmd.freeze();
+
+    REQUIRE(parseBatch(cmd, lines).empty());
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        StringList line;
+        line.push_back(String(SL("-t")));
+
+        if (i % 10) {
+            line.push_back(String(1, static_cast<Char>(SL('0') + i % 10)));
+        }
+
+        if (i % 2) {
+            line.push_back(String(SL("-v")));
+        }
+
+        lines.push_back(line);
+    }
+
+    const auto results = parseBatch(cmd, lines, 4, 7);
+
+    REQUIRE(results.size() == lines.size());
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        if (i % 10) {
+            REQUIRE(!results[i].error());
+            REQUIRE(results[i].value(timeout) == String(1, static_cast<Char>(SL('0') + i % 10)));
+            REQUIRE(results[i].isDefined(verbose) == (i % 2 == 1));
+        } else {
+            REQUIRE(results[i].error().code() == ParseErrorCode::ValueRequired);
+            REQUIRE(results[i].error().argument() == &timeout);
+        }
+    }
+
+    REQUIRE(!timeout.isDefined());
+}
@@ -0,0 +1,134 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+//! Sink that keeps positional arguments.
+class Collector final : public PositionalSinkIface
+{
+public:
+    void positional(String &&word) override
+    {
+        m_words.push_back(std::move(word));
+    }
+
+    StringList m_words;
+}; // class Collector
+
+TEST_CASE("TestPositionalSink")
+{
+    const int argc = 6;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-v"), SL("--"), SL("a"), SL("-v"), SL("b")};
+
+    CmdLine cmd(argc, argv, CmdLine::HandlePositionalArguments);
+
+    Arg v(SL('v'));
+
+    Collector collector;
+
+    cmd.addArg(v);
+    cmd.setPositionalSink(&collector);
+
+    REQUIRE(cmd.positionalSink() == &collector);
+
+    cmd.parse();
+
+    REQUIRE(v.isDefined());
+    REQUIRE(cmd.positional().empty());
+    REQUIRE(collector.m_words.size() == 3);
+    REQUIRE(collector.m_words.back() == SL("b"));
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("x")));
+
+    const ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(result.positional().size() == 1);
+    REQUIRE(collector.m_words.size() == 3);
+}
+
+TEST_CASE("TestPositionalQueue")
+{
+    const std::size_t count = 100000;
+
+    StringList args;
+    args.push_back(String(SL("-v")));
+    args.push_back(String(SL("--")));
+
+    for (std::size_t i = 0; i < count; ++i) {
+        args.push_back(String(i % 2 ? SL("odd") : SL("even")));
+    }
+
+    CmdLine cmd(CmdLine::HandlePositionalArguments);
+
+    Arg v(SL('v'));
+
+    PositionalQueue queue(16);
+
+    cmd.addArg(v);
+    cmd.setPositionalSink(&queue);
+
+    std::vector<std::size_t> evens(4, 0);
+    std::vector<std::size_t> totals(4, 0);
+    std::vector<std::thread> consumers;
+
+    for (std::size_t i = 0; i < evens.size(); ++i) {
+        consumers.emplace_back([&queue, &evens, &totals, i] {
+            String word;
+
+            while (queue.pop(word)) {
+                ++totals[i];
+
+                if (word == SL("even")) {
+                    ++evens[i];
+                }
+            }
+        });
+    }
+
+    cmd.parse(args);
+
+    queue.close();
+
+    for (auto &t : consumers) {
+        t.join();
+    }
+
+    std::size_t even = 0;
+    std::size_t total = 0;
+
+    for (std::size_t i = 0; i < evens.size(); ++i) {
+        even += evens[i];
+        total += totals[i];
+    }
+
+    REQUIRE(v.isDefined());
+    REQUIRE(total == count);
+    REQUIRE(even == count / 2);
+
+    String word;
+
+    REQUIRE(!queue.pop(word));
+}
@@ -0,0 +1,223 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+#include <args-parser/repl.hpp>
+
+// C++ include.
+#include <algorithm>
+#include <vector>
+
+using namespace Args;
+
+static StringList words(std::initializer_list<const Char *> list)
+{
+    StringList res;
+
+    for (const auto &w : list) {
+        res.push_back(String(w));
+    }
+
+    return res;
+}
+
+static bool contains(const StringList &list,
+                     const String &what)
+{
+    return (std::find(list.cbegin(), list.cend(), what) != list.cend());
+}
+
+//! Check that results are the same for the given arguments.
+static void checkSame(const ParseResult &incremental,
+                      const ParseResult &full,
+                      const std::vector<const ArgIface *> &args)
+{
+    REQUIRE(incremental.error().code() == full.error().code());
+    REQUIRE(incremental.error().tokenIndex() == full.error().tokenIndex());
+    REQUIRE(incremental.command() == full.command());
+    REQUIRE(incremental.positional() == full.positional());
+    REQUIRE(incremental.occurrences().size() == full.occurrences().size());
+
+    for (const auto &arg : args) {
+        REQUIRE(incremental.isDefined(*arg) == full.isDefined(*arg));
+        REQUIRE(incremental.count(*arg) == full.count(*arg));
+
+        const ValuesView iv = incremental.values(*arg);
+        const ValuesView fv = full.values(*arg);
+
+        REQUIRE(std::equal(iv.begin(), iv.end(), fv.begin(), fv.end()));
+
+        if (arg->type() == ArgType::Command) {
+            REQUIRE(incremental.subCommand(*static_cast<const Command *>(arg))
+                    == full.subCommand(*static_cast<const Command *>(arg)));
+        }
+    }
+}
+
+TEST_CASE("TestReplIncremental")
+{
+    CmdLine cmd(CmdLine::HandlePositionalArguments);
+
+    Command add(SL("add"));
+    Command put(SL("put"), ValueOptions::ManyValues);
+    Command file(SL("file"));
+    Command dir(SL("dir"), ValueOptions::OneValue);
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), true);
+    MultiArg m(SL('m'), String(SL("mm")), true);
+    MultiArg c(SL('c'), false);
+    Arg f(SL('f'), String(SL("force")), false);
+
+    file.addArg(f);
+    add.addArg(file);
+    add.addArg(dir);
+    cmd.addArg(add);
+    cmd.addArg(put);
+    cmd.addArg(a);
+    cmd.addArg(b);
+    cmd.addArg(m);
+    cmd.addArg(c);
+
+    const std::vector<const ArgIface *> args = {&add, &put, &file, &dir, &a, &b, &m, &c, &f};
+
+    Repl repl(cmd);
+
+    REQUIRE_THROWS_AS(repl.update(words({SL("-a")})), BaseException);
+
+    cmd.freeze();
+
+    const std::vector<StringList> edits = {
+        words({SL("-a")}),
+        words({SL("-a"), SL("-b")}),
+        words({SL("-a"), SL("-b"), SL("1")}),
+        words({SL("-a"), SL("-b"), SL("1"), SL("-m"), SL("x")}),
+        words({SL("-a"), SL("-b"), SL("1"), SL("-m"), SL("x"), SL("y")}),
+        words({SL("-a"), SL("-b"), SL("1"), SL("-m"), SL("x"), SL("y"), SL("-ccc")}),
+        words({SL("-a"), SL("-b"), SL("1"), SL("-m"), SL("x"), SL("y"), SL("-cc")}),
+        words({SL("-a"), SL("-b"), SL("2"), SL("-m"), SL("x"), SL("y"), SL("-cc")}),
+        words({SL("-a"), SL("--bb=3"), SL("-m"), SL("x")}),
+        words({SL("-a"), SL("--bb=3"), SL("-m"), SL("x"), SL("add")}),
+        words({SL("-a"), SL("--bb=3"), SL("add"), SL("file"), SL("-f")}),
+        words({SL("-a"), SL("--bb=3"), SL("add"), SL("file"), SL("-f"), SL("-f")}),
+        words({SL("-a"), SL("--bb=3"), SL("add"), SL("dir"), SL("path"), SL("rest")}),
+        words({SL("-a"), SL("--bb=3"), SL("add"), SL("dir")}),
+        words({SL("-a"), SL("--bb=3"), SL("put"), SL("1"), SL("2"), SL("-a")}),
+        words({SL("-a"), SL("--bb=3"), SL("put"), SL("1"), SL("2"), SL("3")}),
+        words({SL("-a")}),
+        words({}),
+        words({SL("-a"), SL("-a")}),
+        words({SL("-a"), SL("-c"), SL("text")}),
+    };
+
+    for (const auto &line : edits) {
+        const ParseResult &incremental = repl.update(line);
+        const ParseResult full = cmd.parseToResult(line);
+
+        checkSame(incremental, full, args);
+    }
+}
+
+TEST_CASE("TestReplReparsedFrom")
+{
+    CmdLine cmd;
+
+    Command add(SL("add"));
+    Arg a(SL('a'), String(SL("aa")), false);
+    Arg b(SL('b'), String(SL("bb")), true);
+    MultiArg m(SL('m'), String(SL("mm")), true);
+
+    add.addArg(m);
+    cmd.addArg(add);
+    cmd.addArg(a);
+    cmd.addArg(b);
+
+    cmd.freeze();
+
+    Repl repl(cmd);
+
+    repl.update(words({SL("-a"), SL("-b"), SL("1"), SL("add")}));
+
+    REQUIRE(repl.reparsedFrom() == 0);
+    REQUIRE(repl.result().command() == &add);
+
+    repl.update(words({SL("-a"), SL("-b"), SL("1"), SL("add")}));
+
+    REQUIRE(repl.reparsedFrom() == 4);
+
+    // "add" is re-parsed, as it's the last word of the step.
+    repl.update(words({SL("-a"), SL("-b"), SL("1"), SL("add"), SL("-m")}));
+
+    REQUIRE(repl.reparsedFrom() == 3);
+    REQUIRE(repl.result().error().code() == ParseErrorCode::ValueRequired);
+
+    repl.update(words({SL("-a"), SL("-b"), SL("1"), SL("add"), SL("-m"), SL("v")}));
+
+    REQUIRE(repl.reparsedFrom() == 4);
+    REQUIRE(!repl.result().error());
+    REQUIRE(repl.result().value(m) == SL("v"));
+
+    repl.update(words({SL("-a"), SL("-b"), SL("2"), SL("add"), SL("-m"), SL("v")}));
+
+    REQUIRE(repl.reparsedFrom() == 1);
+    REQUIRE(repl.result().value(b) == SL("2"));
+    REQUIRE(repl.result().isDefined(a));
+    REQUIRE(!a.isDefined());
+}
+
+TEST_CASE("TestReplComplete")
+{
+    CmdLine cmd;
+
+    Command add(SL("add"));
+    Command file(SL("file"));
+    Command folder(SL("folder"));
+    Command remove(SL("remove"));
+    Arg force(SL('f'), String(SL("force")), false);
+    Arg format(SL('o'), String(SL("format")), true);
+
+    file.addArg(force);
+    add.addArg(file);
+    add.addArg(folder);
+    cmd.addArg(add);
+    cmd.addArg(remove);
+    cmd.addArg(format);
+
+    cmd.freeze();
+
+    Repl repl(cmd);
+
+    StringList names = repl.complete(SL("--f"));
+
+    REQUIRE(names.size() == 1);
+    REQUIRE(contains(names, SL("--format")));
+
+    repl.update(words({SL("add")}));
+
+    names = repl.complete(SL("f"));
+
+    REQUIRE(names.size() == 2);
+    REQUIRE(contains(names, SL("file")));
+    REQUIRE(contains(names, SL("folder")));
+
+    repl.update(words({SL("add"), SL("file")}));
+
+    names = repl.complete(SL("--f"));
+
+    REQUIRE(names.size() == 2);
+    REQUIRE(contains(names, SL("--force")));
+    REQUIRE(contains(names, SL("--format")));
+
+    repl.update(words({SL("remove")}));
+
+    names = repl.complete(SL("--f"));
+
+    REQUIRE(names.size() == 1);
+    REQUIRE(contains(names, SL("--format")));
+}
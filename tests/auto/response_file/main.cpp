@@ -0,0 +1,225 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+//! Write the file with the given content.
+void writeFile(const char *fileName,
+               const std::string &content)
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+    file << content;
+}
+
+TEST_CASE("TestResponseFileTokens")
+{
+    writeFile("tokens.rsp", "  --name \"hello world\"\t'a \"b\"' c\\ d\r\n\"\" e\"f g\"h \\'i");
+
+    StringList words;
+    details::ResponseFile file;
+
+    REQUIRE(file.open(details::StringView(SL("tokens.rsp"))));
+
+    details::StringView token;
+
+    while (file.next(token)) {
+        words.push_back(token.toString());
+    }
+
+    StringList expected;
+    expected.push_back(String(SL("--name")));
+    expected.push_back(String(SL("hello world")));
+    expected.push_back(String(SL("a \"b\"")));
+    expected.push_back(String(SL("c d")));
+    expected.push_back(String());
+    expected.push_back(String(SL("ef gh")));
+    expected.push_back(String(SL("'i")));
+
+    REQUIRE(words == expected);
+    REQUIRE(!file.open(details::StringView(SL("missing.rsp"))));
+}
+
+TEST_CASE("TestResponseFile")
+{
+    writeFile("main.rsp", "-v --name \"hello world\"\n@nested.rsp\n");
+    writeFile("nested.rsp", "-m 1 -m 2 -t");
+
+    const int argc = 4;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("@main.rsp"), SL("@missing.rsp"), SL("@")};
+
+    CmdLine cmd(argc, argv, CmdLine::HandlePositionalArguments | CmdLine::ExpandResponseFiles);
+
+    Arg v(SL('v'));
+    Arg name(String(SL("name")), true);
+    MultiArg m(SL('m'), true);
+    Arg t(SL('t'));
+
+    cmd.addArg(v);
+    cmd.addArg(name);
+    cmd.addArg(m);
+    cmd.addArg(t);
+
+    cmd.parse();
+
+    REQUIRE(v.isDefined());
+    REQUIRE(name.value() == SL("hello world"));
+    REQUIRE(m.count() == 2);
+    REQUIRE(t.isDefined());
+    REQUIRE(cmd.positional().size() == 2);
+    REQUIRE(cmd.positional().front() == SL("@missing.rsp"));
+    REQUIRE(cmd.positional().back() == SL("@"));
+
+    cmd.parse();
+
+    REQUIRE(name.value() == SL("hello world"));
+
+    CmdLine plain(CmdLine::HandlePositionalArguments);
+
+    plain.parse(2, argv);
+
+    REQUIRE(plain.positional().size() == 1);
+    REQUIRE(plain.positional().front() == SL("@main.rsp"));
+}
+
+TEST_CASE("TestRecursiveResponseFile")
+{
+    writeFile("first.rsp", "-v @second.rsp");
+    writeFile("second.rsp", "@./first.rsp");
+
+    CmdLine cmd(CmdLine::ExpandResponseFiles);
+
+    Arg v(SL('v'));
+
+    cmd.addArg(v);
+
+    const int argc = 3;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("-v"), SL("@first.rsp")};
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::RecursiveResponseFile);
+    REQUIRE(error.tokenIndex() == 1);
+    REQUIRE(error.word() == SL("@first.rsp"));
+    REQUIRE(error.message() == SL("Recursive inclusion of response file \"./first.rsp\"."));
+    REQUIRE(!v.isDefined());
+
+    REQUIRE_THROWS_AS(cmd.parse(argc, argv), BaseException);
+}
+
+TEST_CASE("TestResponseFileMaxDepth")
+{
+    const std::size_t depth = details::ResponseFiles::c_maxDepth;
+
+    // Each file includes the next one, the last one isn't reached.
+    for (std::size_t i = 0; i <= depth; ++i) {
+        writeFile(("depth" + std::to_string(i) + ".rsp").c_str(), "-v @depth" + std::to_string(i + 1) + ".rsp");
+    }
+
+    writeFile(("depth" + std::to_string(depth + 1) + ".rsp").c_str(), "-v");
+
+    CmdLine cmd(CmdLine::ExpandResponseFiles);
+
+    MultiArg v(SL('v'));
+
+    cmd.addArg(v);
+
+    const int argc = 2;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("@depth0.rsp")};
+
+    const ParseError error = cmd.tryParse(argc, argv);
+
+    REQUIRE(error.code() == ParseErrorCode::RecursiveResponseFile);
+    REQUIRE(error.tokenIndex() == 0);
+    REQUIRE(!v.isDefined());
+
+    // Nesting up to the limit is allowed.
+    writeFile(("depth" + std::to_string(depth - 1) + ".rsp").c_str(), "-v");
+
+    REQUIRE(!cmd.tryParse(argc, argv));
+    REQUIRE(v.count() == depth);
+}
+
+TEST_CASE("TestResponseFileParseToResult")
+{
+    writeFile("result.rsp", "--ids 1,2 3 -v --unknown");
+
+    CmdLine cmd(CmdLine::ExpandResponseFiles);
+
+    ListArg<int> ids(String(SL("ids")));
+    Arg v(SL('v'));
+
+    cmd.addArg(ids);
+    cmd.addArg(v);
+
+    cmd.freeze();
+
+    ParseResult result;
+
+    {
+        StringList args;
+        args.push_back(String(SL("@result.rsp")));
+
+        result = cmd.parseToResult(args);
+    }
+
+    REQUIRE(result.error().code() == ParseErrorCode::UnknownArgument);
+    REQUIRE(result.error().tokenIndex() == 4);
+    REQUIRE(result.error().word() == SL("--unknown"));
+}
+
+TEST_CASE("TestResponseFileMany")
+{
+    std::string content = "--ids";
+    std::int64_t sum = 0;
+
+    for (int i = 0; i < 100000; ++i) {
+        content.append(i % 2 ? " " : "\n");
+        content.append(std::to_string(i));
+        content.append(",-1");
+
+        sum += i - 1;
+    }
+
+    writeFile("many.rsp", content);
+
+    CmdLine cmd(CmdLine::ExpandResponseFiles);
+
+    ListArg<std::int64_t> ids(String(SL("ids")));
+
+    cmd.addArg(ids);
+
+    StringList args;
+    args.push_back(String(SL("@many.rsp")));
+
+    cmd.parse(args);
+
+    std::int64_t res = 0;
+
+    for (const auto i : ids.typedValues()) {
+        res += i;
+    }
+
+    REQUIRE(ids.count() == 200000);
+    REQUIRE(res == sum);
+}
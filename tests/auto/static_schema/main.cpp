@@ -0,0 +1,210 @@
+
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+#include <args-parser/static_schema.hpp>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+ARGS_STATIC_SCHEMA(c_schema,
+                   StaticArg(SL('t'), SL("timeout"), true),
+                   StaticArg(SL('v'), SL("verbose")),
+                   StaticArg(SL('d')),
+                   StaticArg(SL("host"), true, true),
+                   StaticMultiArg(SL('f'), SL("file"), true),
+                   StaticMultiArg(SL('l'), SL("level")))
+
+ARGS_STATIC_SCHEMA(c_bigSchema,
+                   StaticArg(SL("alpha")),
+                   StaticArg(SL("bravo")),
+                   StaticArg(SL("charlie")),
+                   StaticArg(SL("delta")),
+                   StaticArg(SL("echo")),
+                   StaticArg(SL("foxtrot")),
+                   StaticArg(SL("golf")),
+                   StaticArg(SL("hotel")),
+                   StaticArg(SL("india")),
+                   StaticArg(SL("juliett")),
+                   StaticArg(SL("kilo")),
+                   StaticArg(SL("lima")),
+                   StaticArg(SL("mike")),
+                   StaticArg(SL("november")),
+                   StaticArg(SL("oscar")),
+                   StaticArg(SL("papa")),
+                   StaticArg(SL("quebec")),
+                   StaticArg(SL("romeo")),
+                   StaticArg(SL("sierra")),
+                   StaticArg(SL("tango")),
+                   StaticArg(SL("uniform")),
+                   StaticArg(SL("victor")),
+                   StaticArg(SL("whiskey")),
+                   StaticArg(SL("x-ray")),
+                   StaticArg(SL("yankee")),
+                   StaticArg(SL("zulu")))
+
+static_assert(makeStaticSchema(StaticArg(SL('t')), StaticArg(SL('t'))).error()
+                  == StaticSchemaError::FlagRedefinition,
+              "Flag redefinition should be detected.");
+static_assert(makeStaticSchema(StaticArg(SL("a")), StaticMultiArg(SL("a"))).error()
+                  == StaticSchemaError::NameRedefinition,
+              "Name redefinition should be detected.");
+static_assert(makeStaticSchema(StaticArg(SL('-'))).error() == StaticSchemaError::DisallowedFlag,
+              "Disallowed flag should be detected.");
+static_assert(makeStaticSchema(StaticArg(SL("a b"))).error() == StaticSchemaError::DisallowedName,
+              "Disallowed name should be detected.");
+static_assert(makeStaticSchema(StaticArg(SL(""))).error() == StaticSchemaError::EmptyFlagAndName,
+              "Empty flag and name should be detected.");
+static_assert(makeStaticSchema(StaticArg(SL('a')), StaticArg(SL('b'), SL("name"))).errorArgument() == 0,
+              "Correct schema.");
+
+TEST_CASE("TestLookup")
+{
+    REQUIRE(c_schema.indexOf(SL("--timeout")) == 0);
+    REQUIRE(c_schema.indexOf(SL("-t")) == 0);
+    REQUIRE(c_schema.indexOf(SL("--verbose")) == 1);
+    REQUIRE(c_schema.indexOf(SL("-d")) == 2);
+    REQUIRE(c_schema.indexOf(SL("--host")) == 3);
+    REQUIRE(c_schema.indexOf(SL("--file")) == 4);
+    REQUIRE(c_schema.indexOf(SL("-l")) == 5);
+    REQUIRE(c_schema.indexOf(SL("--time")) == -1);
+    REQUIRE(c_schema.indexOf(SL("--timeouts")) == -1);
+    REQUIRE(c_schema.indexOf(SL("-x")) == -1);
+    REQUIRE(c_schema.indexOf(SL("--")) == -1);
+    REQUIRE(c_schema.indexOf(SL("-")) == -1);
+    REQUIRE(c_schema.indexOf(SL("timeout")) == -1);
+
+    const CHAR *names[] = {SL("--alpha"),  SL("--bravo"),  SL("--charlie"), SL("--delta"),  SL("--echo"),
+                           SL("--foxtrot"), SL("--golf"),   SL("--hotel"),   SL("--india"),  SL("--juliett"),
+                           SL("--kilo"),   SL("--lima"),   SL("--mike"),    SL("--november"), SL("--oscar"),
+                           SL("--papa"),   SL("--quebec"), SL("--romeo"),   SL("--sierra"), SL("--tango"),
+                           SL("--uniform"), SL("--victor"), SL("--whiskey"), SL("--x-ray"),  SL("--yankee"),
+                           SL("--zulu")};
+
+    for (int i = 0; i < 26; ++i) {
+        REQUIRE(c_bigSchema.indexOf(names[i]) == i);
+    }
+
+    REQUIRE(c_bigSchema.indexOf(SL("--alpha-")) == -1);
+}
+
+TEST_CASE("TestParse")
+{
+    const int argc = 12;
+    const CHAR *argv[argc] = {SL("program.exe"),
+                              SL("-t=100"),
+                              SL("--host"),
+                              SL("localhost"),
+                              SL("-vd"),
+                              SL("--file"),
+                              SL("a"),
+                              SL("b"),
+                              SL("-ll"),
+                              SL("-f"),
+                              SL("c"),
+                              SL("--level")};
+
+    const auto res = c_schema.parse(argc, argv);
+
+    REQUIRE(res.isDefined(SL("--timeout")));
+    REQUIRE(res.value(SL("-t")) == SL("100"));
+    REQUIRE(res.value(SL("--host")) == SL("localhost"));
+    REQUIRE(res.isDefined(SL("-v")));
+    REQUIRE(res.isDefined(SL("-d")));
+    REQUIRE(res.values(SL("--file")).size() == 3);
+    REQUIRE(res.values(SL("--file")).front() == SL("a"));
+    REQUIRE(res.values(SL("--file")).back() == SL("c"));
+    REQUIRE(res.count(5) == 3);
+    REQUIRE(!res.isDefined(SL("--unknown")));
+    REQUIRE(res.positional().empty());
+}
+
+TEST_CASE("TestParsePositional")
+{
+    const int argc = 6;
+    const CHAR *argv[argc] = {SL("program.exe"), SL("--host"), SL("h"), SL("--"), SL("-t"), SL("file")};
+
+    const auto res = c_schema.parse(argc, argv, true);
+
+    REQUIRE(res.value(SL("--host")) == SL("h"));
+    REQUIRE(!res.isDefined(SL("-t")));
+    REQUIRE(res.positional().size() == 2);
+    REQUIRE(res.positional().front() == SL("-t"));
+    REQUIRE(res.positional().back() == SL("file"));
+}
+
+TEST_CASE("TestParseErrors")
+{
+    {
+        const int argc = 2;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-t")};
+
+        REQUIRE_THROWS_AS(c_schema.parse(argc, argv), BaseException);
+    }
+
+    {
+        const int argc = 2;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-x")};
+
+        try {
+            c_schema.parse(argc, argv);
+
+            REQUIRE(false);
+        } catch (const BaseException &x) {
+            REQUIRE(x.desc() == String(SL("Unknown argument \"-x\".")));
+        }
+    }
+
+    {
+        const int argc = 3;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-tv"), SL("1")};
+
+        try {
+            c_schema.parse(argc, argv);
+
+            REQUIRE(false);
+        } catch (const BaseException &x) {
+            REQUIRE(x.desc()
+                    == String(SL("Only last argument in flags combo can be with value. Flags combo is \"-tv\".")));
+        }
+    }
+
+    {
+        const int argc = 2;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-v")};
+
+        try {
+            c_schema.parse(argc, argv);
+
+            REQUIRE(false);
+        } catch (const BaseException &x) {
+            REQUIRE(x.desc() == String(SL("Undefined required argument \"--host\".")));
+        }
+    }
+
+    {
+        const int argc = 5;
+        const CHAR *argv[argc] = {SL("program.exe"), SL("--host"), SL("h"), SL("-v"), SL("--verbose")};
+
+        try {
+            c_schema.parse(argc, argv);
+
+            REQUIRE(false);
+        } catch (const BaseException &x) {
+            REQUIRE(x.desc() == String(SL("Argument \"--verbose\" already defined.")));
+        }
+    }
+}
@@ -0,0 +1,198 @@
+/*
+    SPDX-FileCopyrightText: 2026 Igor Mironchik <igor.mironchik@gmail.com>
+    SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+// doctest include.
+#include <doctest.h>
+
+// Args include.
+#include <args-parser/all.hpp>
+
+// C++ include.
+#include <clocale>
+#include <cstdint>
+#include <limits>
+
+using namespace Args;
+
+#ifdef ARGS_WSTRING_BUILD
+using CHAR = String::value_type;
+#else
+using CHAR = char;
+#endif
+
+TEST_CASE("TestFromString")
+{
+    std::int64_t i = 0;
+
+    REQUIRE(details::fromString(String(SL("123")), i));
+    REQUIRE(i == 123);
+    REQUIRE(details::fromString(String(SL("-9223372036854775808")), i));
+    REQUIRE(i == std::numeric_limits<std::int64_t>::min());
+    REQUIRE(details::fromString(String(SL("+9223372036854775807")), i));
+    REQUIRE(i == std::numeric_limits<std::int64_t>::max());
+    REQUIRE(!details::fromString(String(SL("9223372036854775808")), i));
+    REQUIRE(!details::fromString(String(SL("12a")), i));
+    REQUIRE(!details::fromString(String(SL(" 1")), i));
+    REQUIRE(!details::fromString(String(SL("-")), i));
+    REQUIRE(!details::fromString(String(), i));
+
+    std::uint8_t u = 0;
+
+    REQUIRE(details::fromString(String(SL("255")), u));
+    REQUIRE(u == 255);
+    REQUIRE(!details::fromString(String(SL("256")), u));
+    REQUIRE(!details::fromString(String(SL("-1")), u));
+
+    double d = 0.0;
+
+    REQUIRE(details::fromString(String(SL("2.5")), d));
+    REQUIRE(d == 2.5);
+    REQUIRE(details::fromString(String(SL("-1e3")), d));
+    REQUIRE(d == -1000.0);
+    REQUIRE(!details::fromString(String(SL("2,5")), d));
+    REQUIRE(!details::fromString(String(SL("0x10")), d));
+    REQUIRE(!details::fromString(String(SL("1e999")), d));
+    REQUIRE(!details::fromString(String(SL("1.5 ")), d));
+}
+
+TEST_CASE("TestFromStringIgnoresGlobalLocale")
+{
+    // Locale with "," as the decimal point may be missing on the system.
+    if (!std::setlocale(LC_NUMERIC, "de_DE.UTF-8") && !std::setlocale(LC_NUMERIC, "ru_RU.UTF-8")) {
+        return;
+    }
+
+    double d = 0.0;
+    const bool isConverted = details::fromString(String(SL("2.5")), d);
+
+    std::setlocale(LC_NUMERIC, "C");
+
+    REQUIRE(isConverted);
+    REQUIRE(d == 2.5);
+}
+
+TEST_CASE("TestTypedArg")
+{
+    const int argc = 9;
+    const CHAR *argv[argc] =
+        {SL("program.exe"), SL("-i"), SL("-42"), SL("--real=2.5"), SL("-m"), SL("1"), SL("2"), SL("-m"), SL("3")};
+
+    CmdLine cmd(argc, argv);
+
+    TypedArg<std::int64_t> i(SL('i'), String(SL("int")), true);
+    TypedArg<double> real(String(SL("real")));
+    TypedArg<int> def(SL('d'));
+    TypedMultiArg<unsigned int> m(SL('m'), String(SL("multi")));
+
+    def.setDefaultValue(SL("7"));
+
+    REQUIRE_THROWS_AS(def.setDefaultValue(SL("seven")), BaseException);
+
+    cmd.addArg(i);
+    cmd.addArg(real);
+    cmd.addArg(def);
+    cmd.addArg(m);
+
+    cmd.parse();
+
+    REQUIRE(i.typedValue() == -42);
+    REQUIRE(real.typedValue() == 2.5);
+    REQUIRE(!def.isDefined());
+    REQUIRE(def.typedValue() == 7);
+    REQUIRE(m.typedValues().size() == 3);
+    REQUIRE(m.typedValues()[2] == 3u);
+    REQUIRE(m.typedValue() == 1u);
+
+    cmd.clear();
+
+    REQUIRE(i.typedValue() == 0);
+    REQUIRE(m.typedValues().empty());
+}
+
+TEST_CASE("TestTypedArgInvalidValue")
+{
+    const int argc = 5;
+
+    {
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-m"), SL("1"), SL("x"), SL("-i=2")};
+
+        CmdLine cmd(argc, argv);
+
+        TypedArg<int> i(SL('i'), String(SL("int")));
+        TypedMultiArg<int> m(SL('m'), String(SL("multi")));
+
+        cmd.addArg(i);
+        cmd.addArg(m);
+
+        const ParseError error = cmd.tryParse();
+
+        REQUIRE(error.code() == ParseErrorCode::InvalidValue);
+        REQUIRE(error.argument() == &m);
+        REQUIRE(error.message() == SL("Invalid value \"x\" of argument \"--multi\"."));
+    }
+
+    {
+        const CHAR *argv[argc] = {SL("program.exe"), SL("-m"), SL("1"), SL("2"), SL("-i=2.0")};
+
+        CmdLine cmd(argc, argv);
+
+        TypedArg<int> i(SL('i'), String(SL("int")));
+        TypedMultiArg<int> m(SL('m'), String(SL("multi")));
+
+        cmd.addArg(i);
+        cmd.addArg(m);
+
+        const ParseError error = cmd.tryParse();
+
+        REQUIRE(error.code() == ParseErrorCode::InvalidValue);
+        REQUIRE(error.argument() == &i);
+        REQUIRE(error.tokenIndex() == 3);
+    }
+
+    {
+        const CHAR *argv[3] = {SL("program.exe"), SL("-i"), SL("x")};
+
+        CmdLine cmd(3, argv);
+
+        TypedArg<int> i(SL('i'), String(SL("int")));
+
+        cmd.addArg(i);
+
+        REQUIRE_THROWS_AS(cmd.parse(), BaseException);
+    }
+}
+
+TEST_CASE("TestTypedArgParseToResult")
+{
+    CmdLine cmd;
+
+    TypedArg<int> i(SL('i'), String(SL("int")));
+    TypedMultiArg<double> m(SL('m'), String(SL("multi")));
+
+    cmd.addArg(i);
+    cmd.addArg(m);
+
+    cmd.freeze();
+
+    StringList args;
+    args.push_back(String(SL("-i")));
+    args.push_back(String(SL("10")));
+    args.push_back(String(SL("-m")));
+    args.push_back(String(SL("1.5")));
+
+    ParseResult result = cmd.parseToResult(args);
+
+    REQUIRE(!result.error());
+    REQUIRE(result.value(i) == SL("10"));
+
+    args.push_back(String(SL("one")));
+
+    result = cmd.parseToResult(args);
+
+    REQUIRE(result.error().code() == ParseErrorCode::InvalidValue);
+    REQUIRE(result.error().argument() == &m);
+    REQUIRE(result.error().tokenIndex() == 2);
+}
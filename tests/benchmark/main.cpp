@@ -36,12 +36,12 @@ int main()
         high_resolution_clock::time_point start = high_resolution_clock::now();
         for (unsigned int x = 0; x < 100000; ++x) {
             Args::CmdLine parser(argc, argv);
-            Args::Arg integer('i', "int", true);
+            Args::TypedArg<int> integer('i', "int");
             Args::MultiArg characters('c', "char", true);
             parser.addArg(integer);
             parser.addArg(characters);
             parser.parse();
-            const auto i = std::atoi(integer.value().c_str());
+            const auto i = integer.typedValue();
             const auto &c = characters.values();
             assert(i == 7);
             assert(c[0] == "a");